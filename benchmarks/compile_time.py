@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+
+##
+# Copyright (c) 2025, Roland Bock
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+#  * Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  * Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+# IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+# INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+# OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+# OF THE POSSIBILITY OF SUCH DAMAGE.
+##
+
+# Measures the compile time and peak memory of a generated translation unit
+# with large statements (many columns, joins, and dynamic conditions).
+#
+# Example:
+#   benchmarks/compile_time.py --cxx g++ --include include --include tests/include
+
+import argparse
+import os
+import resource
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def generate_tables(tables, columns):
+    lines = []
+    for t in range(tables):
+        lines.append(f"  struct T{t}_ {{")
+        for c in range(columns):
+            lines.append(f"    struct C{c} {{")
+            lines.append(f"      SQLPP_CREATE_NAME_TAG_FOR_SQL_AND_CPP(c{c}, c{c});")
+            lines.append("      using data_type = std::optional<::sqlpp::integral>;")
+            lines.append("      using has_default = std::true_type;")
+            lines.append("    };")
+        lines.append(f"    SQLPP_CREATE_NAME_TAG_FOR_SQL_AND_CPP(t{t}, t{t});")
+        lines.append("    template<typename T>")
+        column_list = ", ".join(f"C{c}" for c in range(columns))
+        lines.append(f"    using _table_columns = sqlpp::table_columns<T, {column_list}>;")
+        lines.append("    using _required_insert_columns = sqlpp::detail::type_set<>;")
+        lines.append("  };")
+        lines.append(f"  using T{t} = ::sqlpp::table_t<T{t}_>;")
+    return "\n".join(lines)
+
+
+def generate_statement(index, columns, joins, conditions):
+    selected = ", ".join(f"t0.c{c}" for c in range(columns))
+    joined = "t0"
+    for j in range(1, joins + 1):
+        joined = f"{joined}.join(t{j}).on(t{j - 1}.c0 == t{j}.c{index % columns})"
+    where = " and ".join(
+        [f"t0.c1 > {index}"]
+        + [
+            f"dynamic(condition, t{c % (joins + 1)}.c{c % columns} < {c})"
+            for c in range(conditions)
+        ]
+    )
+    return f"""
+  {{
+    auto s = sqlpp::select({selected})
+                 .from({joined})
+                 .where({where});
+    std::cout << to_sql_string(context, s).size() << '\\n';
+    for (const auto& row : db(s)) {{
+      std::cout << row.c0.has_value() << '\\n';
+    }}
+  }}"""
+
+
+def generate_translation_unit(columns, joins, conditions, statements):
+    table_definitions = generate_tables(joins + 1, columns)
+    table_objects = "\n".join(
+        f"  const auto t{t} = bench::T{t}{{}};" for t in range(joins + 1)
+    )
+    statement_code = "".join(
+        generate_statement(i, columns, joins, conditions) for i in range(statements)
+    )
+    return f"""// Generated by benchmarks/compile_time.py
+#include <iostream>
+#include <optional>
+
+#include <sqlpp23/mock_db/mock_db.h>
+#include <sqlpp23/sqlpp23.h>
+#include <sqlpp23/tests/core/make_test_connection.h>
+
+namespace bench {{
+{table_definitions}
+}}  // namespace bench
+
+int main(int argc, char*[]) {{
+  auto db = sqlpp::mock_db::make_test_connection({{}});
+  sqlpp::mock_db::context_t context;
+  const bool condition = argc > 1;
+{table_objects}
+{statement_code}
+  return 0;
+}}
+"""
+
+
+def compile_once(args, source, output):
+    command = (
+        [args.cxx, f"-std={args.std}", "-c", source, "-o", output]
+        + [f"-I{path}" for path in args.include]
+        + args.flag
+    )
+    start = time.perf_counter()
+    result = subprocess.run(command, capture_output=True, text=True)
+    seconds = time.perf_counter() - start
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr)
+        sys.exit(result.returncode)
+    return seconds
+
+
+def main():
+    arg_parser = argparse.ArgumentParser(prog="compile_time.py")
+    arg_parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="compiler")
+    arg_parser.add_argument("--std", default="c++23", help="language standard")
+    arg_parser.add_argument(
+        "--include", action="append", default=[], help="include directory (repeatable)"
+    )
+    arg_parser.add_argument(
+        "--flag", action="append", default=[], help="additional compiler flag (repeatable)"
+    )
+    arg_parser.add_argument("--columns", type=int, default=50, help="selected columns")
+    arg_parser.add_argument("--joins", type=int, default=10, help="joined tables")
+    arg_parser.add_argument("--conditions", type=int, default=20, help="dynamic conditions")
+    arg_parser.add_argument("--statements", type=int, default=1, help="statements per translation unit")
+    arg_parser.add_argument("--repetitions", type=int, default=3, help="compiler runs")
+    arg_parser.add_argument("--keep", help="write the generated translation unit to this path")
+    args = arg_parser.parse_args()
+
+    code = generate_translation_unit(args.columns, args.joins, args.conditions, args.statements)
+    with tempfile.TemporaryDirectory() as directory:
+        source = args.keep or os.path.join(directory, "compile_time.cpp")
+        with open(source, "w") as file:
+            file.write(code)
+        output = os.path.join(directory, "compile_time.o")
+
+        times = [compile_once(args, source, output) for _ in range(args.repetitions)]
+
+    # ru_maxrss is reported in KiB on Linux, but in bytes on macOS.
+    max_rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    max_rss_mib = max_rss / (1024 * 1024) if sys.platform == "darwin" else max_rss / 1024
+
+    print(
+        f"{args.statements} statement(s) with {args.columns} columns, {args.joins} joins, "
+        f"{args.conditions} dynamic conditions"
+    )
+    print(f"compile time: min {min(times):.2f} s, max {max(times):.2f} s")
+    print(f"peak memory: {max_rss_mib:.0f} MiB")
+
+
+if __name__ == "__main__":
+    main()
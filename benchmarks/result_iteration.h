@@ -0,0 +1,241 @@
+#pragma once
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Measures rows per second through sqlpp23's results (result_t, result_row_t,
+// user code) for a couple of result shapes and compares with iterating the
+// same query via the connector's C API. The difference per field is
+// sqlpp23's overhead.
+//
+// Each connector provides a `raw_iterate(sql, kinds)` function that executes
+// the query via the C API and reads each field like sqlpp23 does.
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/sqlpp23.h>
+
+namespace sqlpp::benchmark {
+// Number of rows with values, followed by the same number of rows with NULLs.
+inline constexpr int64_t rows = 10'000;
+inline constexpr size_t repetitions = 10;
+
+// How the C API has to read a field.
+enum class field_kind { integral, floating_point, boolean, text, blob };
+
+// Checksum of what has been read. Prevents the compiler from optimizing away
+// reading the fields and allows comparing sqlpp23 with the C API.
+struct iteration_result {
+  size_t rows = 0;
+  size_t checksum = 0;
+};
+
+inline void consume(size_t& checksum, std::string_view value) {
+  checksum += value.size();
+}
+
+inline void consume(size_t& checksum, std::span<const uint8_t> value) {
+  checksum += value.size();
+}
+
+template <typename T>
+  requires(std::is_arithmetic_v<T>)
+void consume(size_t& checksum, T value) {
+  checksum += static_cast<size_t>(value);
+}
+
+template <typename T>
+void consume(size_t& checksum, const std::optional<T>& value) {
+  if (value) {
+    consume(checksum, *value);
+  } else {
+    ++checksum;
+  }
+}
+
+template <typename Db, typename Table>
+void fill(Db& db, const Table& foo) {
+  const auto text = std::string(200, 'x');
+  const auto blob = std::vector<uint8_t>(1024, uint8_t{42});
+
+  constexpr int64_t chunk_size = 100;
+  for (int64_t chunk = 0; chunk < rows / chunk_size; ++chunk) {
+    auto insert = insert_into(foo).columns(foo.textNnD, foo.intN, foo.doubleN,
+                                           foo.boolN, foo.blobN);
+    for (int64_t i = chunk * chunk_size; i < (chunk + 1) * chunk_size; ++i) {
+      insert.add_values(foo.textNnD = text, foo.intN = i,
+                        foo.doubleN = static_cast<double>(i) / 2.0,
+                        foo.boolN = i % 2 == 0, foo.blobN = blob);
+    }
+    db(insert);
+  }
+  for (int64_t chunk = 0; chunk < rows / chunk_size; ++chunk) {
+    auto insert = insert_into(foo).columns(foo.textNnD, foo.intN, foo.doubleN,
+                                           foo.boolN, foo.blobN);
+    for (int64_t i = 0; i < chunk_size; ++i) {
+      insert.add_values(foo.textNnD = "", foo.intN = std::nullopt,
+                        foo.doubleN = std::nullopt, foo.boolN = std::nullopt,
+                        foo.blobN = std::nullopt);
+    }
+    db(insert);
+  }
+}
+
+template <typename Function>
+auto measure(const Function& function)
+    -> std::pair<iteration_result, std::chrono::nanoseconds> {
+  function();  // Warm up
+  auto result = iteration_result{};
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < repetitions; ++i) {
+    const auto r = function();
+    result.rows += r.rows;
+    result.checksum += r.checksum;
+  }
+  return {result, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)};
+}
+
+template <typename Db,
+          typename MakeContext,
+          typename RawIterate,
+          typename Statement,
+          typename ConsumeRow>
+void report(std::string_view name,
+            Db& db,
+            const MakeContext& make_context,
+            const RawIterate& raw_iterate,
+            const Statement& statement,
+            std::initializer_list<field_kind> kinds,
+            const ConsumeRow& consume_row) {
+  auto context = make_context();
+  const auto sql = to_sql_string(context, statement);
+  const auto fields = std::vector<field_kind>(kinds);
+
+  const auto [sqlpp_result, sqlpp_time] = measure([&] {
+    auto result = iteration_result{};
+    for (const auto& row : db(statement)) {
+      consume_row(result.checksum, row);
+      ++result.rows;
+    }
+    return result;
+  });
+  const auto [raw_result, raw_time] =
+      measure([&] { return raw_iterate(sql, std::span{fields}); });
+
+  if (sqlpp_result.rows != raw_result.rows or
+      sqlpp_result.checksum != raw_result.checksum) {
+    std::cerr << name << ": results differ between sqlpp23 and C API\n";
+  }
+
+  const auto rows_per_second = [](const iteration_result& result,
+                                  std::chrono::nanoseconds time) {
+    return static_cast<double>(result.rows) * 1e9 /
+           static_cast<double>(time.count());
+  };
+  const auto overhead_per_field =
+      static_cast<double>((sqlpp_time - raw_time).count()) /
+      static_cast<double>(sqlpp_result.rows * fields.size());
+
+  std::cout << std::left << std::setw(12) << name << std::right << std::fixed
+            << std::setprecision(0) << std::setw(12)
+            << rows_per_second(sqlpp_result, sqlpp_time)
+            << " rows/s via sqlpp23 " << std::setw(12)
+            << rows_per_second(raw_result, raw_time) << " rows/s via C API "
+            << std::setprecision(1) << std::setw(8) << overhead_per_field
+            << " ns overhead/field\n";
+}
+
+// Fills the (empty) table `foo` and measures all result shapes.
+template <typename Db, typename Table, typename MakeContext, typename RawIterate>
+void run_result_iteration(std::string_view connector,
+                          Db& db,
+                          const Table& foo,
+                          const MakeContext& make_context,
+                          const RawIterate& raw_iterate) {
+  using enum field_kind;
+
+  fill(db, foo);
+  std::cout << connector << " (" << rows << " rows, " << repetitions
+            << " repetitions each)\n";
+
+  report("narrow", db, make_context, raw_iterate,
+         select(foo.id).from(foo).where(foo.id <= rows), {integral},
+         [](size_t& checksum, const auto& row) { consume(checksum, row.id); });
+
+  report("wide", db, make_context, raw_iterate,
+         select(foo.id, foo.textNnD, foo.intN, foo.doubleN, foo.boolN,
+                foo.blobN)
+             .from(foo)
+             .where(foo.id <= rows),
+         {integral, text, integral, floating_point, boolean, blob},
+         [](size_t& checksum, const auto& row) {
+           consume(checksum, row.id);
+           consume(checksum, row.textNnD);
+           consume(checksum, row.intN);
+           consume(checksum, row.doubleN);
+           consume(checksum, row.boolN);
+           consume(checksum, row.blobN);
+         });
+
+  report("text-heavy", db, make_context, raw_iterate,
+         select(foo.textNnD).from(foo).where(foo.id <= rows), {text},
+         [](size_t& checksum, const auto& row) {
+           consume(checksum, row.textNnD);
+         });
+
+  report("blob-heavy", db, make_context, raw_iterate,
+         select(foo.blobN).from(foo).where(foo.id <= rows), {blob},
+         [](size_t& checksum, const auto& row) {
+           consume(checksum, row.blobN);
+         });
+
+  report("null-heavy", db, make_context, raw_iterate,
+         select(foo.intN, foo.doubleN, foo.boolN, foo.blobN)
+             .from(foo)
+             .where(foo.id > rows),
+         {integral, floating_point, boolean, blob},
+         [](size_t& checksum, const auto& row) {
+           consume(checksum, row.intN);
+           consume(checksum, row.doubleN);
+           consume(checksum, row.boolN);
+           consume(checksum, row.blobN);
+         });
+
+  std::cout << '\n';
+}
+}  // namespace sqlpp::benchmark
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Result iteration with mysql, see result_iteration.h. Requires the test
+// database, see make_test_connection.h.
+
+#include "result_iteration.h"
+
+#include <cstdlib>
+
+#include <sqlpp23/tests/mysql/make_test_connection.h>
+#include <sqlpp23/tests/mysql/tables.h>
+
+namespace {
+auto raw_iterate(MYSQL* handle,
+                 const std::string& sql,
+                 std::span<const sqlpp::benchmark::field_kind> kinds)
+    -> sqlpp::benchmark::iteration_result {
+  using enum sqlpp::benchmark::field_kind;
+
+  if (mysql_real_query(handle, sql.data(), sql.size())) {
+    throw sqlpp::exception{mysql_error(handle)};
+  }
+  MYSQL_RES* mysql_result = mysql_store_result(handle);
+  if (mysql_result == nullptr) {
+    throw sqlpp::exception{mysql_error(handle)};
+  }
+
+  auto result = sqlpp::benchmark::iteration_result{};
+  while (MYSQL_ROW row = mysql_fetch_row(mysql_result)) {
+    const unsigned long* lengths = mysql_fetch_lengths(mysql_result);
+    for (size_t i = 0; i < kinds.size(); ++i) {
+      if (row[i] == nullptr) {
+        ++result.checksum;
+        continue;
+      }
+      switch (kinds[i]) {
+        case integral:
+          result.checksum +=
+              static_cast<size_t>(std::strtoll(row[i], nullptr, 10));
+          break;
+        case floating_point:
+          result.checksum += static_cast<size_t>(std::strtod(row[i], nullptr));
+          break;
+        case boolean:
+          result.checksum += row[i][0] == '1' ? 1 : 0;
+          break;
+        case text:
+        case blob:
+          result.checksum += lengths[i];
+          break;
+      }
+    }
+    ++result.rows;
+  }
+  mysql_free_result(mysql_result);
+  return result;
+}
+}  // namespace
+
+int main() {
+  auto db = sqlpp::mysql::make_test_connection(/*log_categories=*/{});
+  test::createTabFoo(db);
+
+  sqlpp::benchmark::run_result_iteration(
+      "mysql", db, test::TabFoo{},
+      [&db] { return sqlpp::mysql::context_t{&db}; },
+      [&db](const std::string& sql,
+            std::span<const sqlpp::benchmark::field_kind> kinds) {
+        return raw_iterate(db.native_handle(), sql, kinds);
+      });
+
+  return 0;
+}
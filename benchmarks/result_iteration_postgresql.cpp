@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Result iteration with postgresql, see result_iteration.h. Requires the test
+// database, see make_test_connection.h.
+
+#include "result_iteration.h"
+
+#include <cstdlib>
+
+#include <sqlpp23/tests/postgresql/make_test_connection.h>
+#include <sqlpp23/tests/postgresql/tables.h>
+
+namespace {
+auto raw_iterate(::PGconn* handle,
+                 const std::string& sql,
+                 std::span<const sqlpp::benchmark::field_kind> kinds)
+    -> sqlpp::benchmark::iteration_result {
+  using enum sqlpp::benchmark::field_kind;
+
+  PGresult* pg_result = PQexec(handle, sql.c_str());
+  if (PQresultStatus(pg_result) != PGRES_TUPLES_OK) {
+    const auto message = std::string{PQresultErrorMessage(pg_result)};
+    PQclear(pg_result);
+    throw sqlpp::exception{message};
+  }
+
+  auto result = sqlpp::benchmark::iteration_result{};
+  const int row_count = PQntuples(pg_result);
+  for (int row = 0; row < row_count; ++row) {
+    for (int i = 0; i < static_cast<int>(kinds.size()); ++i) {
+      if (PQgetisnull(pg_result, row, i)) {
+        ++result.checksum;
+        continue;
+      }
+      const char* value = PQgetvalue(pg_result, row, i);
+      switch (kinds[static_cast<size_t>(i)]) {
+        case integral:
+          result.checksum +=
+              static_cast<size_t>(std::strtoll(value, nullptr, 10));
+          break;
+        case floating_point:
+          result.checksum += static_cast<size_t>(std::strtod(value, nullptr));
+          break;
+        case boolean:
+          result.checksum += value[0] == 't' ? 1 : 0;
+          break;
+        case text:
+          result.checksum +=
+              static_cast<size_t>(PQgetlength(pg_result, row, i));
+          break;
+        case blob: {
+          size_t length = 0;
+          unsigned char* bytes = PQunescapeBytea(
+              reinterpret_cast<const unsigned char*>(value), &length);
+          result.checksum += length;
+          PQfreemem(bytes);
+          break;
+        }
+      }
+    }
+    ++result.rows;
+  }
+  PQclear(pg_result);
+  return result;
+}
+}  // namespace
+
+int main() {
+  auto db = sqlpp::postgresql::make_test_connection("UTC", /*categories=*/{});
+  test::createTabFoo(db);
+
+  sqlpp::benchmark::run_result_iteration(
+      "postgresql", db, test::TabFoo{},
+      [&db] { return sqlpp::postgresql::context_t{&db}; },
+      [&db](const std::string& sql,
+            std::span<const sqlpp::benchmark::field_kind> kinds) {
+        return raw_iterate(db.native_handle(), sql, kinds);
+      });
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Result iteration with sqlite3 (in-memory database), see result_iteration.h.
+
+#include "result_iteration.h"
+
+#include <sqlpp23/tests/sqlite3/make_test_connection.h>
+#include <sqlpp23/tests/sqlite3/tables.h>
+
+namespace {
+auto raw_iterate(::sqlite3* handle,
+                 const std::string& sql,
+                 std::span<const sqlpp::benchmark::field_kind> kinds)
+    -> sqlpp::benchmark::iteration_result {
+  using enum sqlpp::benchmark::field_kind;
+
+  sqlite3_stmt* statement = nullptr;
+  if (sqlite3_prepare_v2(handle, sql.c_str(), static_cast<int>(sql.size()),
+                         &statement, nullptr) != SQLITE_OK) {
+    throw sqlpp::exception{sqlite3_errmsg(handle)};
+  }
+
+  auto result = sqlpp::benchmark::iteration_result{};
+  while (sqlite3_step(statement) == SQLITE_ROW) {
+    for (int i = 0; i < static_cast<int>(kinds.size()); ++i) {
+      if (sqlite3_column_type(statement, i) == SQLITE_NULL) {
+        ++result.checksum;
+        continue;
+      }
+      switch (kinds[static_cast<size_t>(i)]) {
+        case integral:
+        case boolean:
+          result.checksum +=
+              static_cast<size_t>(sqlite3_column_int64(statement, i));
+          break;
+        case floating_point:
+          result.checksum +=
+              static_cast<size_t>(sqlite3_column_double(statement, i));
+          break;
+        // Like sqlpp23, read the value before its size (see sqlite3 docs).
+        case text:
+          sqlite3_column_text(statement, i);
+          result.checksum +=
+              static_cast<size_t>(sqlite3_column_bytes(statement, i));
+          break;
+        case blob:
+          sqlite3_column_blob(statement, i);
+          result.checksum +=
+              static_cast<size_t>(sqlite3_column_bytes(statement, i));
+          break;
+      }
+    }
+    ++result.rows;
+  }
+  sqlite3_finalize(statement);
+  return result;
+}
+}  // namespace
+
+int main() {
+  auto db = sqlpp::sqlite3::make_test_connection(/*categories=*/{});
+  test::createTabFoo(db);
+
+  sqlpp::benchmark::run_result_iteration(
+      "sqlite3", db, test::TabFoo{},
+      [&db] { return sqlpp::sqlite3::context_t{&db}; },
+      [&db](const std::string& sql,
+            std::span<const sqlpp::benchmark::field_kind> kinds) {
+        return raw_iterate(db.native_handle(), sql, kinds);
+      });
+
+  return 0;
+}
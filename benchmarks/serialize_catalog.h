@@ -0,0 +1,179 @@
+#pragma once
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// A catalog of representative statements for benchmarking serialization with
+// any connector's context. Each benchmark executable includes this header
+// exactly once (the allocation counter replaces the global operator new).
+
+#include <sqlpp23/tests/core/allocation_counter.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sqlpp23/sqlpp23.h>
+#include <sqlpp23/tests/core/tables.h>
+
+namespace sqlpp::benchmark {
+inline constexpr size_t iterations = 10'000;
+
+// Serializes the statement `iterations` times into a re-used buffer, with a
+// fresh context for each iteration (as for each execution of a statement).
+// For comparison, allocations are also counted for `to_sql_string`, which
+// creates a fresh string per statement.
+template <typename MakeContext, typename Statement>
+void report(std::string_view name,
+            const MakeContext& make_context,
+            const Statement& statement) {
+  auto buffer = std::string{};
+  {
+    // Warm up, e.g. to reserve the buffer's capacity.
+    auto context = make_context();
+    append_sql_string(context, buffer, statement);
+  }
+
+  const auto counter = sqlpp::test::allocation_counter{};
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    auto context = make_context();
+    buffer.clear();
+    append_sql_string(context, buffer, statement);
+  }
+  const auto duration = std::chrono::steady_clock::now() - start;
+  const auto allocations = counter.allocations();
+
+  size_t fresh_allocations = 0;
+  {
+    const auto fresh_counter = sqlpp::test::allocation_counter{};
+    for (size_t i = 0; i < iterations; ++i) {
+      auto context = make_context();
+      const auto sql = to_sql_string(context, statement);
+    }
+    fresh_allocations = fresh_counter.allocations();
+  }
+
+  const auto ns_per_op =
+      static_cast<double>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+              .count()) /
+      static_cast<double>(iterations);
+  const auto allocs_per_op =
+      static_cast<double>(allocations) / static_cast<double>(iterations);
+  const auto fresh_allocs_per_op =
+      static_cast<double>(fresh_allocations) / static_cast<double>(iterations);
+  std::cout << std::left << std::setw(16) << name << std::right
+            << std::setw(8) << buffer.size() << " chars " << std::fixed
+            << std::setprecision(1) << std::setw(10) << ns_per_op
+            << " ns/op " << std::setprecision(2) << std::setw(8)
+            << allocs_per_op << " allocs/op " << std::setw(8)
+            << fresh_allocs_per_op << " allocs/op via to_sql_string\n";
+}
+
+// Runs the whole catalog with contexts created by `make_context`.
+template <typename MakeContext>
+void run_catalog(std::string_view connector, const MakeContext& make_context) {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  std::cout << connector << " (" << iterations << " iterations each)\n";
+
+  report("wide select", make_context,
+         sqlpp::select(foo.id, foo.textNnD, foo.intN, foo.intCN, foo.doubleN,
+                       foo.uIntN, foo.blobN, foo.boolN)
+             .from(foo)
+             .where(foo.id > 17 and foo.intN.is_not_null() and
+                    foo.textNnD.like("%cake%"))
+             .order_by(foo.id.asc(), foo.intN.desc())
+             .limit(10)
+             .offset(20));
+
+  const auto a_foo = foo.as(sqlpp::alias::a);
+  report("join", make_context,
+         sqlpp::select(foo.id, foo.doubleN, bar.textN, bar.boolNn)
+             .from(foo.join(bar)
+                       .on(foo.id == bar.intN)
+                       .left_outer_join(a_foo)
+                       .on(a_foo.id == bar.id))
+             .where(bar.boolNn and foo.doubleN < 3.14));
+
+  const auto x = sqlpp::cte(sqlpp::alias::x)
+                     .as(sqlpp::select(foo.id, foo.intN)
+                             .from(foo)
+                             .where(foo.boolN.is_not_null()));
+  report("cte", make_context,
+         sqlpp::with(x)
+         << sqlpp::select(x.id, bar.textN)
+                .from(bar.join(x).on(x.intN == bar.id))
+                .where(bar.boolNn));
+
+  report("union", make_context,
+         union_all(union_distinct(sqlpp::select(foo.id, foo.intN)
+                                      .from(foo)
+                                      .where(foo.id < 10),
+                                  sqlpp::select(bar.id, bar.intN)
+                                      .from(bar)
+                                      .where(bar.boolNn)),
+                   sqlpp::select(foo.id, foo.intN)
+                       .from(foo)
+                       .where(foo.intN > 100)));
+
+  auto multi_insert =
+      sqlpp::insert_into(foo).columns(foo.textNnD, foo.intN, foo.boolN);
+  for (int64_t i = 0; i < 100; ++i) {
+    multi_insert.add_values(foo.textNnD = "some text", foo.intN = i,
+                            foo.boolN = i % 2 == 0);
+  }
+  report("multi-row insert", make_context, multi_insert);
+
+  report("dynamic where", make_context,
+         sqlpp::select(foo.id)
+             .from(foo)
+             .where(foo.id > 1 and dynamic(true, foo.intN < 100) and
+                    dynamic(false, foo.boolN.is_null()) and
+                    dynamic(true, foo.textNnD != "cake") and
+                    dynamic(false, foo.doubleN > 1.5)));
+
+  auto ids = std::vector<int64_t>{};
+  for (int64_t i = 0; i < 1'000; ++i) {
+    ids.push_back(i * 7);
+  }
+  report("long in list", make_context,
+         sqlpp::select(foo.id).from(foo).where(foo.id.in(std::move(ids))));
+
+  report("update", make_context,
+         sqlpp::update(foo)
+             .set(foo.intN = foo.intN + 1, foo.textNnD = "updated")
+             .where(foo.id == 17));
+
+  std::cout << '\n';
+}
+}  // namespace sqlpp::benchmark
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Compares the time per operation of the value codec used for serialization,
+// text parameters, and text results with the std::format / strto* based
+// conversions it replaced.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/detail/value_codec.h>
+
+namespace {
+constexpr size_t iterations = 1'000'000;
+
+// Prevents the compiler from optimizing away the benchmarked conversions.
+volatile size_t sink = 0;
+
+template <typename Function>
+auto ns_per_op(const Function& function) -> double {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    function(i);
+  }
+  const auto duration = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+                 .count()) /
+         static_cast<double>(iterations);
+}
+
+template <typename Codec, typename Baseline>
+void report(std::string_view name,
+            const Codec& codec,
+            const Baseline& baseline) {
+  const auto codec_ns = ns_per_op(codec);
+  const auto baseline_ns = ns_per_op(baseline);
+  std::cout << name << ": " << codec_ns << " ns/op via codec, " << baseline_ns
+            << " ns/op via baseline\n";
+}
+}  // namespace
+
+int main() {
+  const auto timestamp = ::sqlpp::chrono::sys_microseconds{
+      std::chrono::sys_days{std::chrono::year{2025} / 3 / 17} +
+      std::chrono::hours{13} + std::chrono::minutes{37} +
+      std::chrono::microseconds{42'123'456}};
+  const auto date = std::chrono::floor<std::chrono::days>(timestamp);
+  const auto time_of_day = std::chrono::microseconds{timestamp - date};
+
+  auto buffer = std::string{};
+
+  report(
+      "format int64",
+      [&](size_t i) {
+        buffer.clear();
+        ::sqlpp::detail::append_integral(buffer,
+                                         static_cast<int64_t>(i) * -7919);
+        sink = sink + buffer.size();
+      },
+      [&](size_t i) {
+        buffer.clear();
+        std::format_to(std::back_inserter(buffer), "{}",
+                       static_cast<int64_t>(i) * -7919);
+        sink = sink + buffer.size();
+      });
+
+  report(
+      "format double",
+      [&](size_t i) {
+        buffer.clear();
+        ::sqlpp::detail::append_floating_point(buffer,
+                                               static_cast<double>(i) / 7.0);
+        sink = sink + buffer.size();
+      },
+      [&](size_t i) {
+        buffer.clear();
+        std::format_to(std::back_inserter(buffer), "{:.{}g}",
+                       static_cast<double>(i) / 7.0,
+                       std::numeric_limits<double>::digits10);
+        sink = sink + buffer.size();
+      });
+
+  report(
+      "format date",
+      [&](size_t i) {
+        buffer.clear();
+        ::sqlpp::detail::append_date(buffer, date + std::chrono::days{i % 64});
+        sink = sink + buffer.size();
+      },
+      [&](size_t i) {
+        buffer.clear();
+        std::format_to(std::back_inserter(buffer), "{0:%Y-%m-%d}",
+                       date + std::chrono::days{i % 64});
+        sink = sink + buffer.size();
+      });
+
+  report(
+      "format time of day",
+      [&](size_t i) {
+        buffer.clear();
+        ::sqlpp::detail::append_time_of_day(
+            buffer, time_of_day + std::chrono::microseconds{i % 64});
+        sink = sink + buffer.size();
+      },
+      [&](size_t i) {
+        buffer.clear();
+        std::format_to(std::back_inserter(buffer), "{0:%H:%M:%S}",
+                       time_of_day + std::chrono::microseconds{i % 64});
+        sink = sink + buffer.size();
+      });
+
+  report(
+      "format timestamp",
+      [&](size_t i) {
+        buffer.clear();
+        ::sqlpp::detail::append_timestamp(
+            buffer, timestamp + std::chrono::microseconds{i % 64});
+        sink = sink + buffer.size();
+      },
+      [&](size_t i) {
+        buffer.clear();
+        std::format_to(std::back_inserter(buffer), "{0:%Y-%m-%d %H:%M:%S}",
+                       timestamp + std::chrono::microseconds{i % 64});
+        sink = sink + buffer.size();
+      });
+
+  auto integers = std::vector<std::string>{};
+  auto doubles = std::vector<std::string>{};
+  for (size_t i = 0; i < 64; ++i) {
+    integers.push_back(::sqlpp::detail::number_to_string(
+        static_cast<int64_t>(i) * -1'000'003));
+    doubles.push_back(
+        ::sqlpp::detail::number_to_string(static_cast<double>(i) / 3.0));
+  }
+
+  report(
+      "parse int64",
+      [&](size_t i) {
+        auto value = int64_t{};
+        ::sqlpp::detail::parse_number(integers[i % 64], value);
+        sink = sink + static_cast<size_t>(value);
+      },
+      [&](size_t i) {
+        const auto value = std::strtoll(integers[i % 64].c_str(), nullptr, 10);
+        sink = sink + static_cast<size_t>(value);
+      });
+
+  report(
+      "parse double",
+      [&](size_t i) {
+        auto value = double{};
+        ::sqlpp::detail::parse_number(doubles[i % 64], value);
+        sink = sink + static_cast<size_t>(value);
+      },
+      [&](size_t i) {
+        const auto value = std::strtod(doubles[i % 64].c_str(), nullptr);
+        sink = sink + static_cast<size_t>(value);
+      });
+
+  return 0;
+}
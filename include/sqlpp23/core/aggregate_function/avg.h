@@ -64,16 +64,31 @@ struct nodes_of<avg_t<Flag, Expr>> {
   using type = sqlpp::detail::type_vector<Expr>;
 };
 
+template <typename Flag, typename Expr>
+struct has_static_sql<avg_t<Flag, Expr>>
+    : public has_static_sql_nodes<avg_t<Flag, Expr>> {};
+
 template <typename Flag, typename Expr>
 struct data_type_of<avg_t<Flag, Expr>> {
   using type = sqlpp::force_optional_t<floating_point>;
 };
 
+template <typename Context, typename Flag, typename Expr>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const avg_t<Flag, Expr>& t) -> void {
+  out += "AVG(";
+  append_sql_string(context, out, Flag());
+  append_sql_string(context, out, read.expression(t));
+  out += ')';
+}
+
 template <typename Context, typename Flag, typename Expr>
 auto to_sql_string(Context& context, const avg_t<Flag, Expr>& t)
     -> std::string {
-  return "AVG(" + to_sql_string(context, Flag()) +
-         to_sql_string(context, read.expression(t)) + ")";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename T>
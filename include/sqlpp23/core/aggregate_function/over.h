@@ -51,12 +51,25 @@ struct over_t : public enable_as, public enable_comparison {
 template <typename Expr>
 struct nodes_of<over_t<Expr>> : public nodes_of<Expr> {};
 
+template <typename Expr>
+struct has_static_sql<over_t<Expr>> : public has_static_sql<Expr> {};
+
 template <typename Expr>
 struct data_type_of<over_t<Expr>> : public data_type_of<Expr> {};
 
+template <typename Context, typename Expr>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const over_t<Expr>& t) -> void {
+  append_operand_sql_string(context, out, read.expression(t));
+  out += " OVER()";
+}
+
 template <typename Context, typename Expr>
 auto to_sql_string(Context& context, const over_t<Expr>& t) -> std::string {
-  return operand_to_sql_string(context, read.expression(t)) + " OVER()";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Expr>
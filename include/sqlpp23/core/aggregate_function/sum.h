@@ -64,6 +64,10 @@ struct nodes_of<sum_t<Flag, Expr>> {
   using type = sqlpp::detail::type_vector<Expr>;
 };
 
+template <typename Flag, typename Expr>
+struct has_static_sql<sum_t<Flag, Expr>>
+    : public has_static_sql_nodes<sum_t<Flag, Expr>> {};
+
 template <typename Flag, typename Expr>
 struct data_type_of<sum_t<Flag, Expr>> {
   using type =
@@ -72,11 +76,22 @@ struct data_type_of<sum_t<Flag, Expr>> {
                                                  data_type_of_t<Expr>>>;
 };
 
+template <typename Context, typename Flag, typename Expr>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const sum_t<Flag, Expr>& t) -> void {
+  out += "SUM(";
+  append_sql_string(context, out, Flag());
+  append_sql_string(context, out, read.expression(t));
+  out += ')';
+}
+
 template <typename Context, typename Flag, typename Expr>
 auto to_sql_string(Context& context, const sum_t<Flag, Expr>& t)
     -> std::string {
-  return "SUM(" + to_sql_string(context, Flag()) +
-         to_sql_string(context, read.expression(t)) + ")";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename T>
@@ -61,6 +61,9 @@ struct column_t : public enable_as, public enable_comparison {
   }
 };
 
+template <typename _Table, typename ColumnSpec>
+struct has_static_sql<column_t<_Table, ColumnSpec>> : public std::true_type {};
+
 template <typename _Table, typename ColumnSpec>
 struct is_aggregate_neutral<column_t<_Table, ColumnSpec>>
     : public std::false_type {};
@@ -95,11 +98,21 @@ struct is_const<column_t<_Table, ColumnSpec>>
     : public std::is_const<typename ColumnSpec::data_type> {};
 
 template <typename Context, typename _Table, typename ColumnSpec>
-auto to_sql_string(Context& context, const column_t<_Table, ColumnSpec>&)
-    -> std::string {
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const column_t<_Table, ColumnSpec>&) -> void {
   using T = column_t<_Table, ColumnSpec>;
 
-  return name_to_sql_string(context, name_tag_of_t<_Table>{}) + "." +
-         name_to_sql_string(context, name_tag_of_t<T>{});
+  append_name_sql_string(context, out, name_tag_of_t<_Table>{});
+  out += '.';
+  append_name_sql_string(context, out, name_tag_of_t<T>{});
+}
+
+template <typename Context, typename _Table, typename ColumnSpec>
+auto to_sql_string(Context& context, const column_t<_Table, ColumnSpec>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 }  // namespace sqlpp
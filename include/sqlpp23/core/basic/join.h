@@ -56,6 +56,13 @@ struct nodes_of<join_t<Lhs, JoinType, Rhs, Condition>> {
   using type = sqlpp::detail::type_vector<Lhs, Rhs, Condition>;
 };
 
+template <>
+struct has_static_sql<unconditional_t> : public std::true_type {};
+
+template <typename Lhs, typename JoinType, typename Rhs, typename Condition>
+struct has_static_sql<join_t<Lhs, JoinType, Rhs, Condition>>
+    : public has_static_sql_nodes<join_t<Lhs, JoinType, Rhs, Condition>> {};
+
 template <typename Lhs, typename JoinType, typename Rhs, typename Condition>
 struct provided_tables_of<join_t<Lhs, JoinType, Rhs, Condition>> {
   using type = detail::make_joined_set_t<provided_tables_of_t<Lhs>,
@@ -102,15 +109,16 @@ template <typename Context,
           typename JoinType,
           typename Rhs,
           typename Condition>
-auto to_sql_string(Context& context,
-                   const join_t<Lhs, JoinType, Rhs, Condition>& t)
-    -> std::string {
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const join_t<Lhs, JoinType, Rhs, Condition>& t) -> void {
   static_assert(not std::is_same<JoinType, cross_join_t>::value);
 
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = to_sql_string(context, t._lhs) + JoinType::_name;
-  ret_val += to_sql_string(context, t._rhs) + " ON ";
-  return ret_val + to_sql_string(context, t._condition);
+  append_sql_string(context, out, t._lhs);
+  out += JoinType::_name;
+  append_sql_string(context, out, t._rhs);
+  out += " ON ";
+  append_sql_string(context, out, t._condition);
 }
 
 template <typename Context,
@@ -118,39 +126,54 @@ template <typename Context,
           typename JoinType,
           typename Rhs,
           typename Condition>
-auto to_sql_string(Context& context,
-                   const join_t<Lhs, JoinType, dynamic_t<Rhs>, Condition>& t)
-    -> std::string {
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const join_t<Lhs, JoinType, dynamic_t<Rhs>, Condition>& t) -> void {
   static_assert(not std::is_same<JoinType, cross_join_t>::value);
+  append_sql_string(context, out, t._lhs);
   if (t._rhs.has_value()) {
-    // Note: Temporary required to enforce parameter ordering.
-    auto ret_val = to_sql_string(context, t._lhs) + JoinType::_name;
-    ret_val += to_sql_string(context, t._rhs.value()) + " ON ";
-    return ret_val + to_sql_string(context, t._condition);
+    out += JoinType::_name;
+    append_sql_string(context, out, t._rhs.value());
+    out += " ON ";
+    append_sql_string(context, out, t._condition);
   }
-  return to_sql_string(context, t._lhs);
 }
 
 template <typename Context, typename Lhs, typename Rhs>
-auto to_sql_string(Context& context,
-                   const join_t<Lhs, cross_join_t, Rhs, unconditional_t>& t)
-    -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = to_sql_string(context, t._lhs) + cross_join_t::_name;
-  return ret_val + to_sql_string(context, t._rhs);
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const join_t<Lhs, cross_join_t, Rhs, unconditional_t>& t)
+    -> void {
+  append_sql_string(context, out, t._lhs);
+  out += cross_join_t::_name;
+  append_sql_string(context, out, t._rhs);
 }
 
 template <typename Context, typename Lhs, typename Rhs>
-auto to_sql_string(
+auto append_sql_string(
     Context& context,
+    std::string& out,
     const join_t<Lhs, cross_join_t, dynamic_t<Rhs>, unconditional_t>& t)
-    -> std::string {
+    -> void {
+  append_sql_string(context, out, t._lhs);
   if (t._rhs.has_value()) {
-    // Note: Temporary required to enforce parameter ordering.
-    auto ret_val = to_sql_string(context, t._lhs) + cross_join_t::_name;
-    return ret_val + to_sql_string(context, t._rhs.value());
+    out += cross_join_t::_name;
+    append_sql_string(context, out, t._rhs.value());
   }
-  return to_sql_string(context, t._lhs);
+}
+
+template <typename Context,
+          typename Lhs,
+          typename JoinType,
+          typename Rhs,
+          typename Condition>
+auto to_sql_string(Context& context,
+                   const join_t<Lhs, JoinType, Rhs, Condition>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Lhs, typename JoinType, typename Rhs>
@@ -47,6 +47,9 @@ struct parameter_t : public enable_as, public enable_comparison {
   ~parameter_t() = default;
 };
 
+template <typename DataType, typename NameTag>
+struct has_static_sql<parameter_t<DataType, NameTag>> : public std::true_type {};
+
 template <typename DataType, typename NameTag>
 struct parameters_of<parameter_t<DataType, NameTag>> {
   using type = detail::type_vector<parameter_t<DataType, NameTag>>;
@@ -78,11 +78,23 @@ struct nodes_of<parameterized_verbatim_t<DataType, Expr>> {
   using type = detail::type_vector<Expr>;
 };
 
+template <typename Context, typename DataType, typename Expr>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const parameterized_verbatim_t<DataType, Expr>& t)
+    -> void {
+  out += t._verbatim_lhs;
+  append_sql_string(context, out, t._expr);
+  out += t._verbatim_rhs;
+}
+
 template <typename Context, typename DataType, typename Expr>
 auto to_sql_string(Context& context,
                    const parameterized_verbatim_t<DataType, Expr>& t)
     -> std::string {
-  return t._verbatim_lhs + to_sql_string(context, t._expr) + t._verbatim_rhs;
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename DataType, typename Expr>
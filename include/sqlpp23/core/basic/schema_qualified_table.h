@@ -63,13 +63,25 @@ struct provided_tables_of<schema_qualified_table_as_t<TableSpec, NameTag>> {
       detail::type_set<schema_qualified_table_as_t<TableSpec, NameTag>>;
 };
 
+template <typename Context, typename TableSpec, typename NameTag>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const schema_qualified_table_as_t<TableSpec, NameTag>& t)
+    -> void {
+  append_sql_string(context, out, t._schema);
+  out += '.';
+  append_name_sql_string(context, out, name_tag_of_t<TableSpec>{});
+  out += " AS ";
+  append_name_sql_string(context, out, NameTag{});
+}
+
 template <typename Context, typename TableSpec, typename NameTag>
 auto to_sql_string(Context& context,
                    const schema_qualified_table_as_t<TableSpec, NameTag>& t)
     -> std::string {
-  return to_sql_string(context, t._schema) + "." +
-         name_to_sql_string(context, name_tag_of_t<TableSpec>{}) + " AS " +
-         name_to_sql_string(context, NameTag{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename TableSpec>
@@ -32,6 +32,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace sqlpp {
 struct star_t {};
 
+template <>
+struct has_static_sql<star_t> : public std::true_type {};
+
 inline constexpr auto star = star_t{};
 
 template <typename Context>
@@ -66,6 +66,10 @@ struct is_table<table_t<TableSpec>> : public std::true_type {};
 template <typename TableSpec>
 struct name_tag_of<table_t<TableSpec>> : public name_tag_of<TableSpec> {};
 
+// Tables have columns as data members, but their SQL is just their name.
+template <typename TableSpec>
+struct has_static_sql<table_t<TableSpec>> : public std::true_type {};
+
 template <typename TableSpec>
 struct provided_tables_of<table_t<TableSpec>> {
   using type = sqlpp::detail::type_set<table_t<TableSpec>>;
@@ -77,8 +81,17 @@ struct required_insert_columns_of<table_t<TableSpec>> {
 };
 
 template <typename Context, typename TableSpec>
-auto to_sql_string(Context& context, const table_t<TableSpec>& /*unused*/)
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const table_t<TableSpec>& /*unused*/) -> void {
+  append_name_sql_string(context, out, name_tag_of_t<TableSpec>{});
+}
+
+template <typename Context, typename TableSpec>
+auto to_sql_string(Context& context, const table_t<TableSpec>& t)
     -> std::string {
-  return name_to_sql_string(context, name_tag_of_t<TableSpec>{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 }  // namespace sqlpp
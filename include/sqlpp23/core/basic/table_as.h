@@ -51,15 +51,29 @@ struct name_tag_of<table_as_t<TableSpec, NameTag>> {
   using type = NameTag;
 };
 
+template <typename TableSpec, typename NameTag>
+struct has_static_sql<table_as_t<TableSpec, NameTag>> : public std::true_type {
+};
+
 template <typename TableSpec, typename NameTag>
 struct provided_tables_of<table_as_t<TableSpec, NameTag>> {
   using type = sqlpp::detail::type_set<table_as_t<TableSpec, NameTag>>;
 };
 
 template <typename Context, typename TableSpec, typename NameTag>
-auto to_sql_string(Context& context, const table_as_t<TableSpec, NameTag>&)
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const table_as_t<TableSpec, NameTag>&) -> void {
+  append_name_sql_string(context, out, name_tag_of_t<TableSpec>{});
+  out += " AS ";
+  append_name_sql_string(context, out, NameTag{});
+}
+
+template <typename Context, typename TableSpec, typename NameTag>
+auto to_sql_string(Context& context, const table_as_t<TableSpec, NameTag>& t)
     -> std::string {
-  return name_to_sql_string(context, name_tag_of_t<TableSpec>{}) + " AS " +
-         name_to_sql_string(context, NameTag{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 }  // namespace sqlpp
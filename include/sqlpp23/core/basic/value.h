@@ -58,9 +58,17 @@ struct nodes_of<value_t<T>> {
 template <typename T>
 struct requires_parentheses<value_t<T>> : public requires_parentheses<T> {};
 
+template <typename Context, typename T>
+auto append_sql_string(Context& context, std::string& out, const value_t<T>& t)
+    -> void {
+  append_sql_string(context, out, t._value);
+}
+
 template <typename Context, typename T>
 auto to_sql_string(Context& context, const value_t<T>& t) -> std::string {
-  return to_sql_string(context, t._value);
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename T>
@@ -60,10 +60,21 @@ struct provided_tables_of<verbatim_table_as_t<NameTag>> {
   using type = detail::type_set<verbatim_table_as_t<NameTag>>;
 };
 
+template <typename Context, typename NameTag>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const verbatim_table_as_t<NameTag>& t) -> void {
+  out += t._representation;
+  out += " AS ";
+  append_name_sql_string(context, out, NameTag{});
+}
+
 template <typename Context, typename NameTag>
 auto to_sql_string(Context& context, const verbatim_table_as_t<NameTag>& t)
     -> std::string {
-  return t._representation + " AS " + name_to_sql_string(context, NameTag{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 struct verbatim_table_t : public enable_join {
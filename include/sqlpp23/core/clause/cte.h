@@ -55,26 +55,40 @@ struct cte_union_t {
 };
 
 template <typename Context, typename Flag, typename Lhs, typename Rhs>
-auto to_sql_string(Context& context, const cte_union_t<Flag, Lhs, Rhs>& t)
-    -> std::string {
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const cte_union_t<Flag, Lhs, Rhs>& t) -> void {
+  append_sql_string(context, out, read.lhs(t));
   if constexpr (is_dynamic<Rhs>::value) {
     if (read.rhs(t).has_value()) {
-      return to_sql_string(context, read.lhs(t)) + " UNION " +
-             to_sql_string(context, Flag{}) +
-             to_sql_string(context, read.rhs(t).value());
+      out += " UNION ";
+      append_sql_string(context, out, Flag{});
+      append_sql_string(context, out, read.rhs(t).value());
     }
-    return to_sql_string(context, read.lhs(t));
   } else {
-    return to_sql_string(context, read.lhs(t)) + " UNION " +
-           to_sql_string(context, Flag{}) + to_sql_string(context, read.rhs(t));
+    out += " UNION ";
+    append_sql_string(context, out, Flag{});
+    append_sql_string(context, out, read.rhs(t));
   }
 }
 
+template <typename Context, typename Flag, typename Lhs, typename Rhs>
+auto to_sql_string(Context& context, const cte_union_t<Flag, Lhs, Rhs>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
+}
+
 template <typename Flag, typename Lhs, typename Rhs>
 struct nodes_of<cte_union_t<Flag, Lhs, Rhs>> {
   using type = detail::type_vector<Lhs, Rhs>;
 };
 
+template <typename Flag, typename Lhs, typename Rhs>
+struct has_static_sql<cte_union_t<Flag, Lhs, Rhs>>
+    : public has_static_sql_nodes<cte_union_t<Flag, Lhs, Rhs>> {};
+
 template <typename NameTagProvider, typename Statement, typename... FieldSpecs>
 struct cte_t;
 
@@ -138,10 +152,20 @@ struct cte_as_t : public cte_member<NewNameTagProvider, FieldSpecs>::type...,
   using _column_tuple_t =
       std::tuple<column_t<cte_ref_t<NewNameTagProvider>, FieldSpecs>...>;
   template <typename Context>
-  friend auto to_sql_string(Context& context, const cte_as_t&) -> std::string {
-    return name_to_sql_string(context, name_tag_of_t<NameTagProvider>{}) +
-           " AS " +
-           name_to_sql_string(context, name_tag_of_t<NewNameTagProvider>{});
+  friend auto append_sql_string(Context& context,
+                                std::string& out,
+                                const cte_as_t&) -> void {
+    append_name_sql_string(context, out, name_tag_of_t<NameTagProvider>{});
+    out += " AS ";
+    append_name_sql_string(context, out, name_tag_of_t<NewNameTagProvider>{});
+  }
+
+  template <typename Context>
+  friend auto to_sql_string(Context& context, const cte_as_t& t)
+      -> std::string {
+    auto result = std::string{};
+    append_sql_string(context, result, t);
+    return result;
   }
 };
 
@@ -151,6 +175,13 @@ template <typename NameTagProvider,
 struct is_table<cte_as_t<NameTagProvider, NewNameTagProvider, ColumnSpecs...>>
     : public std::true_type {};
 
+template <typename NameTagProvider,
+          typename NewNameTagProvider,
+          typename... ColumnSpecs>
+struct has_static_sql<
+    cte_as_t<NameTagProvider, NewNameTagProvider, ColumnSpecs...>>
+    : public std::true_type {};
+
 template <typename NameTagProvider,
           typename NewNameTagProvider,
           typename... ColumnSpecs>
@@ -239,6 +270,20 @@ struct cte_t
   Statement _expression;
 };
 
+template <typename Context,
+          typename NameTagProvider,
+          typename Statement,
+          typename... ColumnSpecs>
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const cte_t<NameTagProvider, Statement, ColumnSpecs...>& t) -> void {
+  append_name_sql_string(context, out, name_tag_of_t<NameTagProvider>{});
+  out += " AS (";
+  append_sql_string(context, out, read.expression(t));
+  out += ')';
+}
+
 template <typename Context,
           typename NameTagProvider,
           typename Statement,
@@ -246,8 +291,9 @@ template <typename Context,
 auto to_sql_string(Context& context,
                    const cte_t<NameTagProvider, Statement, ColumnSpecs...>& t)
     -> std::string {
-  return name_to_sql_string(context, name_tag_of_t<NameTagProvider>{}) +
-         " AS (" + to_sql_string(context, read.expression(t)) + ")";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 // Note that `cte_t` is not a table, because `join` and `from` store
@@ -276,6 +322,11 @@ struct nodes_of<cte_t<NameTagProvider, Statement, ColumnSpecs...>> {
   using type = detail::type_vector<Statement>;
 };
 
+template <typename NameTagProvider, typename Statement, typename... ColumnSpecs>
+struct has_static_sql<cte_t<NameTagProvider, Statement, ColumnSpecs...>>
+    : public has_static_sql_nodes<
+          cte_t<NameTagProvider, Statement, ColumnSpecs...>> {};
+
 template <typename NameTagProvider, typename Statement, typename... ColumnSpecs>
 struct provided_ctes_of<cte_t<NameTagProvider, Statement, ColumnSpecs...>> {
   using type = detail::type_set<cte_ref_t<NameTagProvider>>;
@@ -297,10 +348,22 @@ struct cte_ref_t {
   }
 };
 
+template <typename NameTagProvider>
+struct has_static_sql<cte_ref_t<NameTagProvider>> : public std::true_type {};
+
+template <typename Context, typename NameTagProvider>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const cte_ref_t<NameTagProvider>&) -> void {
+  append_name_sql_string(context, out, name_tag_of_t<NameTagProvider>{});
+}
+
 template <typename Context, typename NameTagProvider>
-auto to_sql_string(Context& context, const cte_ref_t<NameTagProvider>&)
+auto to_sql_string(Context& context, const cte_ref_t<NameTagProvider>& t)
     -> std::string {
-  return name_to_sql_string(context, name_tag_of_t<NameTagProvider>{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename NameTagProvider>
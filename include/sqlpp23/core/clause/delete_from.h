@@ -37,6 +37,9 @@
 namespace sqlpp {
 struct delete_t {};
 
+template <>
+struct has_static_sql<delete_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const delete_t&) -> std::string {
   return "DELETE FROM ";
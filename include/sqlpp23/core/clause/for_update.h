@@ -34,6 +34,9 @@
 namespace sqlpp {
 struct for_update_t {};
 
+template <>
+struct has_static_sql<for_update_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const for_update_t&) -> std::string {
   return " FOR UPDATE";
@@ -61,6 +64,9 @@ struct no_for_update_t {
   }
 };
 
+template <>
+struct has_static_sql<no_for_update_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_for_update_t&) -> std::string {
   return "";
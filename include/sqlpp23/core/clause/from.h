@@ -52,9 +52,18 @@ struct from_t {
   _Table _table;
 };
 
+template <typename Context, typename _Table>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const from_t<_Table>& t) -> void {
+  append_dynamic_clause_sql_string(context, out, "FROM", read.table(t));
+}
+
 template <typename Context, typename _Table>
 auto to_sql_string(Context& context, const from_t<_Table>& t) -> std::string {
-  return dynamic_clause_to_sql_string(context, "FROM", read.table(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename _Table>
@@ -73,6 +82,10 @@ struct nodes_of<from_t<_Table>> {
   using type = detail::type_vector<_Table>;
 };
 
+template <typename _Table>
+struct has_static_sql<from_t<_Table>>
+    : public has_static_sql_nodes<from_t<_Table>> {};
+
 template <typename _Table>
 struct provided_tables_of<from_t<_Table>> : public provided_tables_of<_Table> {
 };
@@ -94,6 +107,9 @@ struct no_from_t {
   }
 };
 
+template <>
+struct has_static_sql<no_from_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_from_t&) -> std::string {
   return "";
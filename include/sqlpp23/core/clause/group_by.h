@@ -53,11 +53,20 @@ struct group_by_t {
   std::tuple<Expressions...> _expressions;
 };
 
+template <typename Context, typename... Expressions>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const group_by_t<Expressions...>& t) -> void {
+  append_dynamic_tuple_clause_sql_string(context, out, "GROUP BY",
+                                         read.expressions(t));
+}
+
 template <typename Context, typename... Expressions>
 auto to_sql_string(Context& context, const group_by_t<Expressions...>& t)
     -> std::string {
-  return dynamic_tuple_clause_to_sql_string(context, "GROUP BY",
-                                            read.expressions(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 class assert_no_unknown_tables_in_group_by_t : public wrapped_static_assert {
@@ -141,6 +150,10 @@ struct nodes_of<group_by_t<Expressions...>> {
   using type = detail::type_vector<Expressions...>;
 };
 
+template <typename... Expressions>
+struct has_static_sql<group_by_t<Expressions...>>
+    : public has_static_sql_nodes<group_by_t<Expressions...>> {};
+
 // NO GROUP BY YET
 struct no_group_by_t {
   template <typename Statement, DynamicValue... Expressions>
@@ -154,6 +167,9 @@ struct no_group_by_t {
   }
 };
 
+template <>
+struct has_static_sql<no_group_by_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_group_by_t&) -> std::string {
   return "";
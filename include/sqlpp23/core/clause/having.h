@@ -52,10 +52,19 @@ struct having_t {
   Expression _expression;
 };
 
+template <typename Context, typename Expression>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const having_t<Expression>& t) -> void {
+  append_dynamic_clause_sql_string(context, out, "HAVING", read.expression(t));
+}
+
 template <typename Context, typename Expression>
 auto to_sql_string(Context& context, const having_t<Expression>& t)
     -> std::string {
-  return dynamic_clause_to_sql_string(context, "HAVING", read.expression(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 class assert_no_unknown_tables_in_having_t : public wrapped_static_assert {
@@ -108,6 +117,10 @@ struct nodes_of<having_t<Expression>> {
   using type = detail::type_vector<Expression>;
 };
 
+template <typename Expression>
+struct has_static_sql<having_t<Expression>>
+    : public has_static_sql_nodes<having_t<Expression>> {};
+
 template <typename Statement, typename Expression>
 struct consistency_check<Statement, having_t<Expression>> {
   using type = static_combined_check_t<
@@ -151,6 +164,9 @@ struct no_having_t {
   }
 };
 
+template <>
+struct has_static_sql<no_having_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_having_t&) -> std::string {
   return "";
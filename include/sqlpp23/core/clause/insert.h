@@ -39,6 +39,9 @@
 namespace sqlpp {
 struct insert_t {};
 
+template <>
+struct has_static_sql<insert_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const insert_t&) -> std::string {
   return "INSERT";
@@ -56,12 +56,22 @@ struct insert_value_t {
 };
 
 template <typename Context, typename Column>
-auto to_sql_string(Context& context, const insert_value_t<Column>& t)
-    -> std::string {
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const insert_value_t<Column>& t) -> void {
   if (t._is_default) {
-    return "DEFAULT";
+    out += "DEFAULT";
+    return;
   }
-  return operand_to_sql_string(context, t._value);
+  append_operand_sql_string(context, out, t._value);
+}
+
+template <typename Context, typename Column>
+auto to_sql_string(Context& context, const insert_value_t<Column>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Column>
@@ -61,21 +61,24 @@ struct have_all_required_assignments {
 struct tuple_lhs_assignment_operand_no_dynamic {
   template <typename Context, typename Lhs, typename Op, typename Rhs>
   auto operator()(Context& context,
+                  std::string& out,
                   const assign_expression<Lhs, Op, Rhs>&,
-                  size_t) const -> std::string {
-    const auto prefix = need_prefix ? std::string{separator} : std::string{};
+                  size_t) const -> void {
+    if (need_prefix) {
+      out += separator;
+    }
     need_prefix = true;
-    return prefix + name_to_sql_string(context, name_tag_of_t<Lhs>{});
+    append_name_sql_string(context, out, name_tag_of_t<Lhs>{});
   }
 
   template <typename Context, typename T>
   auto operator()(Context& context,
+                  std::string& out,
                   const sqlpp::dynamic_t<T>& t,
-                  size_t index) const -> std::string {
+                  size_t index) const -> void {
     if (t.has_value()) {
-      return operator()(context, t.value(), index);
+      operator()(context, out, t.value(), index);
     }
-    return "";
   }
 
   std::string_view separator;
@@ -87,21 +90,24 @@ struct tuple_lhs_assignment_operand_no_dynamic {
 struct tuple_rhs_assignment_operand_no_dynamic {
   template <typename Context, typename Lhs, typename Op, typename Rhs>
   auto operator()(Context& context,
+                  std::string& out,
                   const assign_expression<Lhs, Op, Rhs>& t,
-                  size_t) const -> std::string {
-    const auto prefix = need_prefix ? std::string{separator} : std::string{};
+                  size_t) const -> void {
+    if (need_prefix) {
+      out += separator;
+    }
     need_prefix = true;
-    return prefix + operand_to_sql_string(context, read.rhs(t));
+    append_operand_sql_string(context, out, read.rhs(t));
   }
 
   template <typename Context, typename T>
   auto operator()(Context& context,
+                  std::string& out,
                   const sqlpp::dynamic_t<T>& t,
-                  size_t index) const -> std::string {
+                  size_t index) const -> void {
     if (t.has_value()) {
-      return operator()(context, t.value(), index);
+      operator()(context, out, t.value(), index);
     }
-    return "";
   }
 
   std::string_view separator;
@@ -118,6 +124,9 @@ struct insert_default_values_t {
   }
 };
 
+template <>
+struct has_static_sql<insert_default_values_t> : public std::true_type {};
+
 template <>
 struct is_clause<insert_default_values_t> : public std::true_type {};
 
@@ -177,17 +186,25 @@ struct insert_set_t {
 };
 
 template <typename Context, typename... Assignments>
-auto to_sql_string(Context& context, const insert_set_t<Assignments...>& t)
-    -> std::string {
-  auto result = std::string{" ("};
-  result += tuple_to_sql_string(
-      context, read.assignments(t),
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const insert_set_t<Assignments...>& t) -> void {
+  out += " (";
+  append_tuple_sql_string(
+      context, out, read.assignments(t),
       detail::tuple_lhs_assignment_operand_no_dynamic{", "});
-  result += ") VALUES(";
-  result += tuple_to_sql_string(
-      context, read.assignments(t),
+  out += ") VALUES(";
+  append_tuple_sql_string(
+      context, out, read.assignments(t),
       detail::tuple_rhs_assignment_operand_no_dynamic{", "});
-  result += ")";
+  out += ')';
+}
+
+template <typename Context, typename... Assignments>
+auto to_sql_string(Context& context, const insert_set_t<Assignments...>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
   return result;
 }
 
@@ -225,6 +242,10 @@ struct nodes_of<insert_set_t<Assignments...>> {
   using type = detail::type_vector<Assignments...>;
 };
 
+template <typename... Assignments>
+struct has_static_sql<insert_set_t<Assignments...>>
+    : public has_static_sql_nodes<insert_set_t<Assignments...>> {};
+
 template <typename Tuple, typename... Assignments>
 concept CorrectAddValuesAssignments = requires(Assignments... assignments) {
   Tuple{make_insert_value_t<lhs_t<Assignments>>(
@@ -260,25 +281,32 @@ struct column_list_t {
 };
 
 template <typename Context, typename... Columns>
-auto to_sql_string(Context& context, const column_list_t<Columns...>& t)
-    -> std::string {
-  auto result = std::string{" ("};
-  result += tuple_to_sql_string(context, read.columns(t),
-                                tuple_operand_no_dynamic{", "});
-  result += ")";
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const column_list_t<Columns...>& t) -> void {
+  out += " (";
+  append_tuple_sql_string(context, out, read.columns(t),
+                          tuple_operand_no_dynamic{", "});
+  out += ')';
   bool first = true;
   for (const auto& row : read.expressions(t)) {
     if (first) {
-      result += " VALUES ";
+      out += " VALUES ";
       first = false;
     } else {
-      result += ", ";
+      out += ", ";
     }
-    result += '(';
-    result += tuple_to_sql_string(context, row, tuple_operand_no_dynamic{", "});
-    result += ')';
+    out += '(';
+    append_tuple_sql_string(context, out, row, tuple_operand_no_dynamic{", "});
+    out += ')';
   }
+}
 
+template <typename Context, typename... Columns>
+auto to_sql_string(Context& context, const column_list_t<Columns...>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
   return result;
 }
 
@@ -358,6 +386,9 @@ struct no_insert_value_list_t {
   }
 };
 
+template <>
+struct has_static_sql<no_insert_value_list_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_insert_value_list_t&) -> std::string {
   return "";
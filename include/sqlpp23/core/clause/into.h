@@ -51,9 +51,19 @@ struct into_t {
   _Table _table;
 };
 
+template <typename Context, typename _Table>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const into_t<_Table>& t) -> void {
+  out += " INTO ";
+  append_sql_string(context, out, read.table(t));
+}
+
 template <typename Context, typename _Table>
 auto to_sql_string(Context& context, const into_t<_Table>& t) -> std::string {
-  return " INTO " + to_sql_string(context, read.table(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename _Table>
@@ -72,6 +82,10 @@ struct nodes_of<into_t<_Table>> {
   using type = detail::type_vector<_Table>;
 };
 
+template <typename _Table>
+struct has_static_sql<into_t<_Table>>
+    : public has_static_sql_nodes<into_t<_Table>> {};
+
 template <typename _Table>
 struct required_insert_columns_of<into_t<_Table>>
     : public required_insert_columns_of<_Table> {};
@@ -97,6 +111,9 @@ struct no_into_t {
   }
 };
 
+template <>
+struct has_static_sql<no_into_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_into_t&) -> std::string {
   return "";
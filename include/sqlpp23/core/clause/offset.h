@@ -48,15 +48,28 @@ struct offset_t {
   Expression _expression;
 };
 
+template <typename Context, typename Expression>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const offset_t<Expression>& t) -> void {
+  append_dynamic_clause_sql_string(context, out, "OFFSET", read.expression(t));
+}
+
 template <typename Context, typename Expression>
 auto to_sql_string(Context& context, const offset_t<Expression>& t)
     -> std::string {
-  return dynamic_clause_to_sql_string(context, "OFFSET", read.expression(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Expression>
 struct is_clause<offset_t<Expression>> : public std::true_type {};
 
+template <typename Expression>
+struct has_static_sql<offset_t<Expression>> : public has_static_sql<Expression> {
+};
+
 template <typename Expression>
 struct contains_offset<offset_t<Expression>> : public std::true_type {};
 
@@ -87,6 +100,9 @@ struct no_offset_t {
   }
 };
 
+template <>
+struct has_static_sql<no_offset_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_offset_t&) -> std::string {
   return "";
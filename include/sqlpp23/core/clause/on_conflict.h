@@ -85,14 +85,27 @@ struct on_conflict_t {
 };
 
 template <typename Context, typename... Columns>
-auto to_sql_string(Context& context,
-                   const on_conflict_t<Columns...>& t) -> std::string {
-  const auto targets = tuple_to_sql_string(context, read.columns(t),
-                                           tuple_operand_name_no_dynamic{", "});
-  if (targets.empty()) {
-    return " ON CONFLICT";
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const on_conflict_t<Columns...>& t) -> void {
+  out += " ON CONFLICT (";
+  const auto targets_start = out.size();
+  append_tuple_sql_string(context, out, read.columns(t),
+                          tuple_operand_name_no_dynamic{", "});
+  if (out.size() == targets_start) {
+    // No (active) conflict targets: Drop the opening parenthesis.
+    out.resize(targets_start - 2);
+    return;
   }
-  return " ON CONFLICT (" + targets + ")";
+  out += ')';
+}
+
+template <typename Context, typename... Columns>
+auto to_sql_string(Context& context, const on_conflict_t<Columns...>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Columns>
@@ -100,6 +113,10 @@ struct nodes_of<on_conflict_t<Columns...>> {
   using type = detail::type_vector<Columns...>;
 };
 
+template <typename... Columns>
+struct has_static_sql<on_conflict_t<Columns...>>
+    : public has_static_sql_nodes<on_conflict_t<Columns...>> {};
+
 template <typename Statement, typename... Columns>
 struct consistency_check<Statement, on_conflict_t<Columns...>> {
   using type = assert_on_conflict_action_t;
@@ -117,6 +134,9 @@ struct no_on_conflict_t {
   }
 };
 
+template <>
+struct has_static_sql<no_on_conflict_t> : public std::true_type {};
+
 template<typename Context>
 auto to_sql_string(Context&, const no_on_conflict_t&) -> std::string {
   return "";
@@ -48,11 +48,21 @@ struct on_conflict_do_nothing_t {
   OnConflict _on_conflict;
 };
 
+template <typename Context, typename OnConflict>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const on_conflict_do_nothing_t<OnConflict>& t) -> void {
+  append_sql_string(context, out, read.on_conflict(t));
+  out += " DO NOTHING";
+}
+
 template <typename Context, typename OnConflict>
 auto to_sql_string(Context& context,
                    const on_conflict_do_nothing_t<OnConflict>& t)
     -> std::string {
-  return to_sql_string(context, read.on_conflict(t)) + " DO NOTHING";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename ConflictTarget>
@@ -64,6 +74,10 @@ struct nodes_of<on_conflict_do_nothing_t<ConflictTarget>> {
   using type = detail::type_vector<ConflictTarget>;
 };
 
+template <typename ConflictTarget>
+struct has_static_sql<on_conflict_do_nothing_t<ConflictTarget>>
+    : public has_static_sql_nodes<on_conflict_do_nothing_t<ConflictTarget>> {};
+
 template <typename Statement, typename ConflictTarget>
 struct consistency_check<Statement,
                          on_conflict_do_nothing_t<ConflictTarget>> {
@@ -81,14 +81,25 @@ struct on_conflict_do_update_where_t {
   Expression _expression;
 };
 
+template <typename Context, typename OnConflictUpdate, typename Expression>
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const on_conflict_do_update_where_t<OnConflictUpdate, Expression>& t)
+    -> void {
+  append_sql_string(context, out, read.on_conflict_update(t));
+  out += " WHERE ";
+  append_sql_string(context, out, read.expression(t));
+}
+
 template <typename Context, typename OnConflictUpdate, typename Expression>
 auto to_sql_string(
     Context& context,
     const on_conflict_do_update_where_t<OnConflictUpdate, Expression>& t)
     -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = to_sql_string(context, read.on_conflict_update(t)) + " WHERE ";
-  return ret_val + to_sql_string(context, read.expression(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename OnConflictUpdate, typename Expression>
@@ -97,6 +108,12 @@ struct nodes_of<
   using type = detail::type_vector<OnConflictUpdate, Expression>;
 };
 
+template <typename OnConflictUpdate, typename Expression>
+struct has_static_sql<
+    on_conflict_do_update_where_t<OnConflictUpdate, Expression>>
+    : public has_static_sql_nodes<
+          on_conflict_do_update_where_t<OnConflictUpdate, Expression>> {};
+
 template <typename OnConflictUpdate, typename Expression>
 struct is_clause<
     on_conflict_do_update_where_t<OnConflictUpdate, Expression>>
@@ -159,13 +176,24 @@ struct on_conflict_do_update_t {
   std::tuple<Assignments...> _assignments;
 };
 
+template <typename Context, typename OnConflict, typename... Assignments>
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const on_conflict_do_update_t<OnConflict, Assignments...>& t) -> void {
+  append_sql_string(context, out, read.on_conflict(t));
+  out += " DO UPDATE SET ";
+  append_tuple_sql_string(context, out, read.assignments(t),
+                          tuple_operand_no_dynamic{", "});
+}
+
 template <typename Context, typename OnConflict, typename... Assignments>
 auto to_sql_string(Context& context,
                    const on_conflict_do_update_t<OnConflict, Assignments...>& t)
     -> std::string {
-  return to_sql_string(context, read.on_conflict(t)) + " DO UPDATE SET " +
-         tuple_to_sql_string(context, read.assignments(t),
-                             tuple_operand_no_dynamic{", "});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename OnConflict, typename... Assignments>
@@ -179,6 +207,11 @@ struct nodes_of<
   using type = detail::type_vector<OnConflict, Assignments...>;
 };
 
+template <typename OnConflict, typename... Assignments>
+struct has_static_sql<on_conflict_do_update_t<OnConflict, Assignments...>>
+    : public has_static_sql_nodes<
+          on_conflict_do_update_t<OnConflict, Assignments...>> {};
+
 template <typename Statement, typename OnConflict, typename... Assignments>
 struct consistency_check<
     Statement,
@@ -77,11 +77,20 @@ struct order_by_t {
   std::tuple<Expressions...> _expressions;
 };
 
+template <typename Context, typename... Expressions>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const order_by_t<Expressions...>& t) -> void {
+  append_dynamic_tuple_clause_sql_string(context, out, "ORDER BY",
+                                         read.expressions(t));
+}
+
 template <typename Context, typename... Expressions>
 auto to_sql_string(Context& context, const order_by_t<Expressions...>& t)
     -> std::string {
-  return dynamic_tuple_clause_to_sql_string(context, "ORDER BY",
-                                            read.expressions(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Expressions>
@@ -202,6 +211,10 @@ struct nodes_of<order_by_t<Expressions...>> {
   using type = detail::type_vector<Expressions...>;
 };
 
+template <typename... Expressions>
+struct has_static_sql<order_by_t<Expressions...>>
+    : public has_static_sql_nodes<order_by_t<Expressions...>> {};
+
 // NO ORDER BY YET
 struct no_order_by_t {
   template <typename Statement, DynamicSortOrder... Expressions>
@@ -213,6 +226,9 @@ struct no_order_by_t {
   }
 };
 
+template <>
+struct has_static_sql<no_order_by_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_order_by_t&) -> std::string {
   return "";
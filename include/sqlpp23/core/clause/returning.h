@@ -80,11 +80,21 @@ struct returning_t {
   std::tuple<Columns...> _columns;
 };
 
+template <typename Context, typename... Columns>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const returning_t<Columns...>& t) -> void {
+  out += " RETURNING ";
+  append_tuple_sql_string(context, out, read.columns(t),
+                          tuple_operand_select_column{", "});
+}
+
 template <typename Context, typename... Columns>
 auto to_sql_string(Context& context, const returning_t<Columns...>& t)
     -> std::string {
-  return " RETURNING " + tuple_to_sql_string(context, read.columns(t),
-                                             tuple_operand_select_column{", "});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Columns>
@@ -146,6 +156,10 @@ struct nodes_of<returning_t<Columns...>> {
   using type = detail::type_vector<Columns...>;
 };
 
+template <typename... Columns>
+struct has_static_sql<returning_t<Columns...>>
+    : public has_static_sql_nodes<returning_t<Columns...>> {};
+
 template <typename... Columns>
 struct is_clause<returning_t<Columns...>> : public std::true_type {};
 
@@ -203,6 +217,9 @@ struct no_returning_t {
   }
 };
 
+template <>
+struct has_static_sql<no_returning_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_returning_t&) -> std::string {
   return "";
@@ -45,6 +45,9 @@
 namespace sqlpp {
 struct select_t {};
 
+template <>
+struct has_static_sql<select_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const select_t&) -> std::string {
   return "SELECT ";
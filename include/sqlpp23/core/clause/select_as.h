@@ -36,6 +36,9 @@ namespace sqlpp {
 template <typename NameTag>
 struct select_ref_t {};
 
+template <typename NameTag>
+struct has_static_sql<select_ref_t<NameTag>> : public std::true_type {};
+
 template <typename NameTag>
 struct name_tag_of<select_ref_t<NameTag>> {
   using type = NameTag;
@@ -67,6 +70,19 @@ struct select_as_t
   Select _expression;
 };
 
+template <typename Context,
+          typename Select,
+          typename NameTag,
+          typename... FieldSpecs>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const select_as_t<Select, NameTag, FieldSpecs...>& t)
+    -> void {
+  append_operand_sql_string(context, out, read.expression(t));
+  out += " AS ";
+  append_name_sql_string(context, out, NameTag{});
+}
+
 template <typename Context,
           typename Select,
           typename NameTag,
@@ -74,8 +90,9 @@ template <typename Context,
 auto to_sql_string(Context& context,
                    const select_as_t<Select, NameTag, FieldSpecs...>& t)
     -> std::string {
-  return operand_to_sql_string(context, read.expression(t)) + " AS " +
-         name_to_sql_string(context, NameTag{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 // No data_type_of defined. select_as_t represents a table, not a value.
@@ -93,6 +110,11 @@ struct nodes_of<select_as_t<Select, NameTag, FieldSpecs...>> {
   using type = detail::type_vector<Select>;
 };
 
+template <typename Select, typename NameTag, typename... FieldSpecs>
+struct has_static_sql<select_as_t<Select, NameTag, FieldSpecs...>>
+    : public has_static_sql_nodes<
+          select_as_t<Select, NameTag, FieldSpecs...>> {};
+
 template <typename Select, typename NameTag, typename... FieldSpecs>
 struct is_table<select_as_t<Select, NameTag, FieldSpecs...>>
     : std::integral_constant<bool, can_be_used_as_table<Select>::value> {};
@@ -115,17 +115,28 @@ struct select_column_list_t<std::tuple<Flags...>, std::tuple<Columns...>> {
 };
 
 template <typename Context, typename... Flags, typename... Columns>
-auto to_sql_string(
+auto append_sql_string(
     Context& context,
+    std::string& out,
     const select_column_list_t<std::tuple<Flags...>, std::tuple<Columns...>>& t)
-    -> std::string {
+    -> void {
   // dynamic(false, foo.id) -> NULL as id
   // dynamic(false, foo.id).as(cheesecake) -> NULL AS cheesecake
   // max(something).as(cheesecake) -> max(something) AS cheesecake
-  return tuple_to_sql_string(context, read.flags(t),
-                             tuple_operand_no_dynamic{""}) +
-         tuple_to_sql_string(context, read.columns(t),
-                             tuple_operand_select_column{", "});
+  append_tuple_sql_string(context, out, read.flags(t),
+                          tuple_operand_no_dynamic{""});
+  append_tuple_sql_string(context, out, read.columns(t),
+                          tuple_operand_select_column{", "});
+}
+
+template <typename Context, typename... Flags, typename... Columns>
+auto to_sql_string(
+    Context& context,
+    const select_column_list_t<std::tuple<Flags...>, std::tuple<Columns...>>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Flags, typename... Columns>
@@ -246,6 +257,12 @@ struct nodes_of<
   using type = detail::type_vector<Columns...>;
 };
 
+template <typename... Flags, typename... Columns>
+struct has_static_sql<
+    select_column_list_t<std::tuple<Flags...>, std::tuple<Columns...>>>
+    : public logic::all<has_static_sql<Flags>::value...,
+                        has_static_sql<Columns>::value...> {};
+
 class assert_columns_selected_t : public wrapped_static_assert {
  public:
   template <typename... T>
@@ -278,6 +295,9 @@ struct no_select_column_list_t {
   }
 };
 
+template <>
+struct has_static_sql<no_select_column_list_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_select_column_list_t&) -> std::string {
   return "";
@@ -37,6 +37,9 @@ namespace sqlpp {
 // standard select flags
 struct all_t {};
 
+template <>
+struct has_static_sql<all_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const all_t&) -> std::string {
   return "ALL ";
@@ -49,6 +52,9 @@ struct is_raw_select_flag<all_t> : public std::true_type {};
 
 struct distinct_t {};
 
+template <>
+struct has_static_sql<distinct_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const distinct_t&) -> std::string {
   return "DISTINCT ";
@@ -61,6 +67,9 @@ struct is_raw_select_flag<distinct_t> : public std::true_type {};
 
 struct no_flag_t {};
 
+template <>
+struct has_static_sql<no_flag_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_flag_t&) -> std::string {
   return "";
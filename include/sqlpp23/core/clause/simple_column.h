@@ -44,10 +44,22 @@ struct simple_column_t {
   Column _column;
 };
 
+template <typename Column>
+struct has_static_sql<simple_column_t<Column>> : public std::true_type {};
+
+template <typename Context, typename Column>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const simple_column_t<Column>&) -> void {
+  append_name_sql_string(context, out, name_tag_of_t<Column>{});
+}
+
 template <typename Context, typename Column>
-auto to_sql_string(Context& context, const simple_column_t<Column>&)
+auto to_sql_string(Context& context, const simple_column_t<Column>& t)
     -> std::string {
-  return name_to_sql_string(context, name_tag_of_t<Column>{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Column>
@@ -52,10 +52,19 @@ struct single_table_t {
   _Table _table;
 };
 
+template <typename Context, typename _Table>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const single_table_t<_Table>& t) -> void {
+  append_sql_string(context, out, read.table(t));
+}
+
 template <typename Context, typename _Table>
 auto to_sql_string(Context& context, const single_table_t<_Table>& t)
     -> std::string {
-  return to_sql_string(context, read.table(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename _Table>
@@ -74,6 +83,10 @@ struct nodes_of<single_table_t<_Table>> {
   using type = detail::type_vector<_Table>;
 };
 
+template <typename _Table>
+struct has_static_sql<single_table_t<_Table>>
+    : public has_static_sql_nodes<single_table_t<_Table>> {};
+
 template <typename _Table>
 struct provided_tables_of<single_table_t<_Table>>
     : public provided_tables_of<_Table> {};
@@ -88,6 +101,9 @@ struct no_single_table_t {
   }
 };
 
+template <>
+struct has_static_sql<no_single_table_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_single_table_t&) -> std::string {
   return "";
@@ -37,6 +37,9 @@
 namespace sqlpp {
 struct truncate_t {};
 
+template <>
+struct has_static_sql<truncate_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const truncate_t&) -> std::string {
   return "TRUNCATE ";
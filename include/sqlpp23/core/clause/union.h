@@ -60,24 +60,31 @@ struct union_t {
 };
 
 template <typename Context, typename Flag, typename Lhs, typename Rhs>
-auto to_sql_string(Context& context, const union_t<Flag, Lhs, Rhs>& t)
-    -> std::string {
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const union_t<Flag, Lhs, Rhs>& t) -> void {
+  append_sql_string(context, out, read.lhs(t));
   if constexpr (is_dynamic<Rhs>::value) {
     if (read.rhs(t).has_value()) {
-      // Note: Temporary required to enforce parameter ordering.
-      auto ret_val = to_sql_string(context, read.lhs(t)) + " UNION ";
-      ret_val += to_sql_string(context, Flag{});
-      return ret_val += to_sql_string(context, read.rhs(t).value());
+      out += " UNION ";
+      append_sql_string(context, out, Flag{});
+      append_sql_string(context, out, read.rhs(t).value());
     }
-    return to_sql_string(context, read.lhs(t));
   } else {
-    // Note: Temporary required to enforce parameter ordering.
-    auto ret_val = to_sql_string(context, read.lhs(t)) + " UNION ";
-    ret_val += to_sql_string(context, Flag{});
-    return ret_val += to_sql_string(context, read.rhs(t));
+    out += " UNION ";
+    append_sql_string(context, out, Flag{});
+    append_sql_string(context, out, read.rhs(t));
   }
 }
 
+template <typename Context, typename Flag, typename Lhs, typename Rhs>
+auto to_sql_string(Context& context, const union_t<Flag, Lhs, Rhs>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
+}
+
 template <typename Flag, typename Lhs, typename Rhs>
 struct has_result_row<union_t<Flag, Lhs, Rhs>> : public std::true_type {};
 
@@ -102,6 +109,10 @@ struct nodes_of<union_t<Flag, Lhs, Rhs>> {
   using type = detail::type_vector<Lhs, Rhs>;
 };
 
+template <typename Flag, typename Lhs, typename Rhs>
+struct has_static_sql<union_t<Flag, Lhs, Rhs>>
+    : public has_static_sql_nodes<union_t<Flag, Lhs, Rhs>> {};
+
 template <typename Statement, typename Flag, typename Lhs, typename Rhs>
 struct consistency_check<Statement, union_t<Flag, Lhs, Rhs>> {
   using type = static_combined_check_t<
@@ -173,6 +184,9 @@ struct no_union_t {
   }
 };
 
+template <>
+struct has_static_sql<no_union_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_union_t&) -> std::string {
   return "";
@@ -35,6 +35,9 @@ namespace sqlpp {
 // standard select flags
 struct union_all_t {};
 
+template <>
+struct has_static_sql<union_all_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const union_all_t&) -> std::string {
   return "ALL ";
@@ -42,6 +45,9 @@ auto to_sql_string(Context&, const union_all_t&) -> std::string {
 
 struct union_distinct_t {};
 
+template <>
+struct has_static_sql<union_distinct_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const union_distinct_t&) -> std::string {
   return "DISTINCT ";
@@ -70,10 +70,20 @@ struct simple_sort_order_expression {
   sort_type _rhs;
 };
 
+template <typename Context, typename L>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const simple_sort_order_expression<L>& t) -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  append_sql_string(context, out, read.rhs(t));
+}
+
 template <typename Context, typename L>
 auto to_sql_string(Context& context, const simple_sort_order_expression<L>& t)
     -> std::string {
-  return operand_to_sql_string(context, read.lhs(t)) + to_sql_string(context, read.rhs(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 namespace detail {
@@ -138,11 +148,20 @@ struct union_order_by_t {
   std::tuple<Expressions...> _expressions;
 };
 
+template <typename Context, typename... Expressions>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const union_order_by_t<Expressions...>& t) -> void {
+  append_dynamic_tuple_clause_sql_string(context, out, "ORDER BY",
+                                         read.expressions(t));
+}
+
 template <typename Context, typename... Expressions>
 auto to_sql_string(Context& context, const union_order_by_t<Expressions...>& t)
     -> std::string {
-  return dynamic_tuple_clause_to_sql_string(context, "ORDER BY",
-                                            read.expressions(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Expressions>
@@ -199,6 +218,10 @@ struct nodes_of<union_order_by_t<Expressions...>> {
   using type = detail::type_vector<Expressions...>;
 };
 
+template <typename... Expressions>
+struct has_static_sql<union_order_by_t<Expressions...>>
+    : public has_static_sql_nodes<union_order_by_t<Expressions...>> {};
+
 // NO ORDER BY YET
 struct no_union_order_by_t {
   template <typename Statement, DynamicSortOrder... Expressions>
@@ -212,6 +235,9 @@ struct no_union_order_by_t {
   }
 };
 
+template <>
+struct has_static_sql<no_union_order_by_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_union_order_by_t&) -> std::string {
   return "";
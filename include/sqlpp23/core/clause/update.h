@@ -39,6 +39,9 @@
 namespace sqlpp {
 struct update_t {};
 
+template <>
+struct has_static_sql<update_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const update_t&) -> std::string {
   return "UPDATE ";
@@ -50,11 +50,21 @@ struct update_set_list_t {
   std::tuple<Assignments...> _assignments;
 };
 
+template <typename Context, typename... Assignments>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const update_set_list_t<Assignments...>& t) -> void {
+  out += " SET ";
+  append_tuple_sql_string(context, out, read.assignments(t),
+                          tuple_operand_no_dynamic{", "});
+}
+
 template <typename Context, typename... Assignments>
 auto to_sql_string(Context& context, const update_set_list_t<Assignments...>& t)
     -> std::string {
-  return " SET " + tuple_to_sql_string(context, read.assignments(t),
-                                       tuple_operand_no_dynamic{", "});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 class assert_no_unknown_tables_in_update_assignments_t
@@ -87,6 +97,10 @@ struct nodes_of<update_set_list_t<Assignments...>> {
   using type = detail::type_vector<Assignments...>;
 };
 
+template <typename... Assignments>
+struct has_static_sql<update_set_list_t<Assignments...>>
+    : public has_static_sql_nodes<update_set_list_t<Assignments...>> {};
+
 template <DynamicAssignment... Assignments>
 inline constexpr bool are_valid_update_assignments =
     (sizeof...(Assignments) > 0 and
@@ -110,6 +124,9 @@ struct no_update_set_list_t {
   }
 };
 
+template <>
+struct has_static_sql<no_update_set_list_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_update_set_list_t&) -> std::string {
   return "";
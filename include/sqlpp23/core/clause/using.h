@@ -57,9 +57,18 @@ struct using_t {
   _Table _table;
 };
 
+template <typename Context, typename _Table>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const using_t<_Table>& t) -> void {
+  append_dynamic_clause_sql_string(context, out, "USING", read.table(t));
+}
+
 template <typename Context, typename _Table>
 auto to_sql_string(Context& context, const using_t<_Table>& t) -> std::string {
-  return dynamic_clause_to_sql_string(context, "USING", read.table(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename _Table>
@@ -70,6 +79,10 @@ struct nodes_of<using_t<_Table>> {
   using type = detail::type_vector<_Table>;
 };
 
+template <typename _Table>
+struct has_static_sql<using_t<_Table>>
+    : public has_static_sql_nodes<using_t<_Table>> {};
+
 template <typename Statement, typename _Table>
 struct consistency_check<Statement, using_t<_Table>> {
   using type = consistent_t;
@@ -96,6 +109,9 @@ struct no_using_t {
   }
 };
 
+template <>
+struct has_static_sql<no_using_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_using_t&) -> std::string {
   return {};
@@ -51,10 +51,19 @@ struct where_t {
   Expression _expression;
 };
 
+template <typename Context, typename Expression>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const where_t<Expression>& t) -> void {
+  append_dynamic_clause_sql_string(context, out, "WHERE", read.expression(t));
+}
+
 template <typename Context, typename Expression>
 auto to_sql_string(Context& context, const where_t<Expression>& t)
     -> std::string {
-  return dynamic_clause_to_sql_string(context, "WHERE", read.expression(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 class assert_no_unknown_tables_in_where_t : public wrapped_static_assert {
@@ -113,6 +122,10 @@ struct nodes_of<where_t<Expression>> {
   using type = detail::type_vector<Expression>;
 };
 
+template <typename Expression>
+struct has_static_sql<where_t<Expression>>
+    : public has_static_sql_nodes<where_t<Expression>> {};
+
 // NO WHERE YET
 struct no_where_t {
   template <typename Statement, DynamicBoolean Expression>
@@ -124,6 +137,9 @@ struct no_where_t {
   }
 };
 
+template <>
+struct has_static_sql<no_where_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_where_t&) -> std::string {
   return "";
@@ -55,12 +55,22 @@ struct with_t {
 };
 
 template <typename Context, typename... Ctes>
-auto to_sql_string(Context& context, const with_t<Ctes...>& t) -> std::string {
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const with_t<Ctes...>& t) -> void {
   static constexpr bool _is_recursive =
       logic::any<is_recursive_cte<Ctes>::value...>::value;
 
-  return std::string("WITH ") + (_is_recursive ? "RECURSIVE " : "") +
-         tuple_to_sql_string(context, read.ctes(t), tuple_operand{", "}) + " ";
+  out += _is_recursive ? "WITH RECURSIVE " : "WITH ";
+  append_tuple_sql_string(context, out, read.ctes(t), tuple_operand{", "});
+  out += ' ';
+}
+
+template <typename Context, typename... Ctes>
+auto to_sql_string(Context& context, const with_t<Ctes...>& t) -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Ctes>
@@ -81,6 +91,10 @@ struct consistency_check<Statement, with_t<Ctes...>> {
 template <typename... Ctes>
 struct nodes_of<with_t<Ctes...>> : public no_nodes {};
 
+template <typename... Ctes>
+struct has_static_sql<with_t<Ctes...>>
+    : public logic::all<has_static_sql<Ctes>::value...> {};
+
 template <typename... Ctes>
 struct provided_ctes_of<with_t<Ctes...>> {
   using type = detail::make_joined_set_t<provided_ctes_of_t<Ctes>...>;
@@ -169,6 +183,9 @@ struct no_with_t {
   }
 };
 
+template <>
+struct has_static_sql<no_with_t> : public std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const no_with_t&) -> std::string {
   return "";
@@ -29,7 +29,15 @@
  */
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
+
+#include <sqlpp23/core/database/parameter_list.h>
+#include <sqlpp23/core/database/prepared_statement_cache.h>
+#include <sqlpp23/core/query/statement_handler.h>
+#include <sqlpp23/core/query/static_sql.h>
+#include <sqlpp23/core/type_traits.h>
 
 namespace sqlpp {
 struct connection {};
@@ -45,6 +53,65 @@ class common_connection : public ConnectionBase {
     return ConnectionBase::_handle.ping_server();
   }
 
+  //! Prepares the statement when it is used for the first time and keeps the
+  //! prepared statement in the connection's cache (keyed by its SQL text and
+  //! type, see connection_config::prepared_statement_cache_size). Literal
+  //! values are replaced by parameters and bound on each call, so statements
+  //! that differ only in their values share one prepared statement.
+  //! Parameters can be set via the returned pointer, which keeps the prepared
+  //! statement alive even if it is evicted from the cache. It must not
+  //! outlive the connection, though.
+  template <typename Statement>
+    requires(sqlpp::is_statement_v<Statement>)
+  auto cached(const Statement& statement) -> std::shared_ptr<
+      decltype(std::declval<ConnectionBase&>().prepare(statement))> {
+    using _prepared_t =
+        decltype(std::declval<ConnectionBase&>().prepare(statement));
+    auto& cache = ConnectionBase::_handle.prepared_statements;
+    typename ConnectionBase::_context_t context{this};
+    auto literals = typename ConnectionBase::_literals_t{};
+    ConnectionBase::_collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& sql = statement_sql_string(context, statement, buffer);
+    auto prepared = cache.template find<_prepared_t>(sql);
+    if (not prepared) {
+      prepared = cache.insert(
+          sql, _prepared_t{ConnectionBase::template _prepare_cached<Statement>(
+                   sql, context)});
+    }
+    if (not literals.empty()) {
+      ConnectionBase::_bind_cached_literals(
+          statement_handler_t{}.get_prepared_statement(*prepared),
+          std::move(literals), literal_positions(context._parameters));
+    }
+    return prepared;
+  }
+
+  //! Runs the statement as a cached prepared statement, see `cached`.
+  template <typename Statement>
+    requires(sqlpp::is_statement_v<Statement> and
+             parameters_of_t<Statement>::empty())
+  auto run_cached(const Statement& statement) {
+    return ConnectionBase::operator()(*cached(statement));
+  }
+
+  const prepared_statement_cache_stats& get_prepared_statement_cache_stats()
+      const {
+    return ConnectionBase::_handle.prepared_statements.stats();
+  }
+
+  //! Returns the SQL and the number of hits of the cached statements, most
+  //! recently used first. The SQL strings are valid until the cache is
+  //! modified.
+  std::vector<prepared_statement_cache_entry>
+  get_prepared_statement_cache_entries() const {
+    return ConnectionBase::_handle.prepared_statements.entries();
+  }
+
+  void clear_prepared_statement_cache() {
+    ConnectionBase::_handle.prepared_statements.clear();
+  }
+
  protected:
   using ConnectionBase::ConnectionBase;
 };
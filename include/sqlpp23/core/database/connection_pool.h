@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <utility>
 
 namespace sqlpp {
 enum class connection_check { none, passive, ping };
@@ -76,7 +77,15 @@ class connection_pool {
     }
 
     void put(_handle_t& handle) {
+      // State set up by the previous user, e.g. sqlite3 change hooks.
+      if constexpr (requires { handle.reset_session(); }) {
+        handle.reset_session();
+      }
       std::unique_lock<std::mutex> lock{_mutex};
+      // Connections using an outdated config are dropped, see reconfigure.
+      if (handle.config != _connection_config) {
+        return;
+      }
       if (_handles.full()) {
         _handles.set_capacity(_handles.capacity() + 5);
       }
@@ -89,6 +98,16 @@ class connection_pool {
       return _handles.size();
     }
 
+    void reconfigure(const _config_ptr_t& connection_config) {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _connection_config = connection_config;
+      auto outdated = std::exchange(
+          _handles,
+          sqlpp::detail::circular_buffer<_handle_t>{_handles.capacity()});
+      lock.unlock();
+      // Outdated connections are closed without holding the lock.
+    }
+
    private:
     inline bool check_connection(_handle_t& handle, connection_check check) {
       switch (check) {
@@ -131,6 +150,13 @@ class connection_pool {
     return _core->get(check);
   }
 
+  // Switches to a new connection config. Idle connections are closed.
+  // Connections that are currently in use are closed when they are returned
+  // to the pool. Subsequently created connections use the new config.
+  void reconfigure(const _config_ptr_t& connection_config) {
+    _core->reconfigure(connection_config);
+  }
+
   // Returns number of connections available in the pool. Only used in tests.
   std::size_t available() { return _core->available(); }
 
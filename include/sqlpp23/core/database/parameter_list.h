@@ -27,15 +27,26 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <array>
+#include <optional>
 #include <tuple>
+#include <typeindex>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include <sqlpp23/core/detail/type_vector.h>
+#include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/query/bind_parameter.h>
 #include <sqlpp23/core/type_traits.h>
 #include <sqlpp23/core/wrong.h>
 
 namespace sqlpp {
+// Position of each parameter of a statement in the serialized statement, see
+// `active_parameters`.
+using parameter_positions_t = std::vector<std::optional<size_t>>;
+
 template <typename T>
 struct parameter_list_t {
   static_assert(
@@ -56,6 +67,18 @@ struct parameter_list_t<detail::type_vector<Parameter...>>
     _bind_impl(target, std::make_index_sequence<size::value>{});
   }
 
+  // Binds the active parameters only, see `active_parameters`. Empty
+  // positions mean that all parameters are serialized in list order.
+  template <typename Target>
+  void _bind(Target& target, const parameter_positions_t& positions) const {
+    if (positions.empty()) {
+      _bind(target);
+      return;
+    }
+    _bind_active_impl(target, positions,
+                      std::make_index_sequence<size::value>{});
+  }
+
  private:
   template <typename Target, size_t... Is>
   void _bind_impl(Target& target,
@@ -65,8 +88,99 @@ struct parameter_list_t<detail::type_vector<Parameter...>>
          std::tuple_element<Is, _member_tuple_t>::type::operator()()),
      ...);
   }
+
+  template <typename Target, size_t... Is>
+  void _bind_active_impl(Target& target,
+                         const parameter_positions_t& positions,
+                         const std::index_sequence<Is...>& /*unused*/) const {
+    ((positions[Is].has_value()
+          ? bind_parameter(
+                target, *positions[Is],
+                std::tuple_element<Is, _member_tuple_t>::type::operator()())
+          : void()),
+     ...);
+  }
 };
 
 template <typename Exp>
 using make_parameter_list_t = parameter_list_t<parameters_of_t<Exp>>;
+
+// Parameters in inactive dynamic parts of a statement (see `dynamic`) are not
+// serialized and must not be bound. Connectors therefore record parameters
+// while serializing a statement for preparation.
+using serialized_parameters_t = std::vector<std::type_index>;
+
+template <typename Parameter>
+auto record_parameter(serialized_parameters_t& serialized) -> void {
+  serialized.emplace_back(typeid(Parameter));
+}
+
+// Literals that are replaced by parameters (see `cached` and the
+// `auto_parameterize` option of connectors) occupy positions, too.
+struct literal_placeholder_t {};
+
+inline auto record_literal(serialized_parameters_t& serialized) -> void {
+  serialized.emplace_back(typeid(literal_placeholder_t));
+}
+
+// Returns the positions of the literals recorded via `record_literal`.
+inline auto literal_positions(const serialized_parameters_t& serialized)
+    -> std::vector<size_t> {
+  auto positions = std::vector<size_t>{};
+  for (size_t position = 0; position < serialized.size(); ++position) {
+    if (serialized[position] == typeid(literal_placeholder_t)) {
+      positions.push_back(position);
+    }
+  }
+  return positions;
+}
+
+namespace detail {
+template <typename... Parameter>
+auto active_parameters(const type_vector<Parameter...>&,
+                       const serialized_parameters_t& serialized)
+    -> parameter_positions_t {
+  // Parameters of a statement have distinct types (they are bases of its
+  // parameter list), so the type identifies the index in the list.
+  const auto indexes = std::array<std::type_index, sizeof...(Parameter)>{
+      std::type_index{typeid(Parameter)}...};
+  auto positions = parameter_positions_t(sizeof...(Parameter));
+  auto in_list_order = serialized.size() == sizeof...(Parameter);
+  for (size_t position = 0; position < serialized.size(); ++position) {
+    if (serialized[position] == typeid(literal_placeholder_t)) {
+      continue;
+    }
+    const auto index = static_cast<size_t>(
+        std::find(indexes.begin(), indexes.end(), serialized[position]) -
+        indexes.begin());
+    if (index == indexes.size() or positions[index].has_value()) {
+      throw sqlpp::exception{
+          "serialized parameters do not match the parameters of the "
+          "statement"};
+    }
+    positions[index] = position;
+    in_list_order = in_list_order and index == position;
+  }
+  if (in_list_order) {
+    return {};
+  }
+  return positions;
+}
+}  // namespace detail
+
+// Returns the position of each parameter of the statement in the serialized
+// statement (none for inactive parameters). The result is empty if all
+// parameters are serialized in list order.
+template <typename Statement>
+auto active_parameters(const serialized_parameters_t& serialized)
+    -> parameter_positions_t {
+  if constexpr (has_static_sql<Statement>::value) {
+    // Static SQL is serialized only once, see `static_sql_string`. It does
+    // not contain dynamic parts, though.
+    return {};
+  } else {
+    return detail::active_parameters(parameters_of_t<Statement>{},
+                                     serialized);
+  }
+}
 }  // namespace sqlpp
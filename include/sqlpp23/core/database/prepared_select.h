@@ -61,7 +61,10 @@ class prepared_select_t {
     return {statement_handler_t{}.run_prepared_select(*this, db)};
   }
 
-  void _bind_parameters() { parameters._bind(_prepared_statement); }
+  void _bind_parameters() {
+    parameters._bind(_prepared_statement,
+                     _prepared_statement._active_parameters);
+  }
 
   _prepared_statement_t _prepared_statement;
 };
@@ -0,0 +1,150 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace sqlpp {
+struct prepared_statement_cache_stats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+};
+
+struct prepared_statement_cache_entry {
+  std::string_view sql;
+  uint64_t hits = 0;
+};
+}  // namespace sqlpp
+
+namespace sqlpp::detail {
+// Least recently used cache of prepared statements, keyed by SQL text. The
+// type of the prepared statement is stored along with it, since statements of
+// different types might result in the same SQL text (e.g. with parameters of
+// different data types).
+// Used by `cached` and `run_cached` of normal and pooled connections.
+class prepared_statement_cache {
+  struct entry {
+    std::string sql;
+    std::type_index type;
+    std::shared_ptr<void> prepared;
+    uint64_t hits = 0;
+  };
+
+  size_t _capacity = 0;
+  std::list<entry> _entries;  // most recently used first
+  // Keys refer to the sql strings in _entries.
+  std::unordered_map<std::string_view, std::list<entry>::iterator> _index;
+  prepared_statement_cache_stats _stats;
+
+ public:
+  prepared_statement_cache() = default;
+  explicit prepared_statement_cache(size_t capacity) : _capacity{capacity} {}
+  prepared_statement_cache(const prepared_statement_cache&) = delete;
+  prepared_statement_cache(prepared_statement_cache&&) = default;
+  prepared_statement_cache& operator=(const prepared_statement_cache&) = delete;
+  prepared_statement_cache& operator=(prepared_statement_cache&&) = default;
+  ~prepared_statement_cache() = default;
+
+  size_t capacity() const { return _capacity; }
+  size_t size() const { return _entries.size(); }
+  const prepared_statement_cache_stats& stats() const { return _stats; }
+
+  // Most recently used first.
+  std::vector<prepared_statement_cache_entry> entries() const {
+    auto result = std::vector<prepared_statement_cache_entry>{};
+    result.reserve(_entries.size());
+    for (const auto& e : _entries) {
+      result.push_back({.sql = e.sql, .hits = e.hits});
+    }
+    return result;
+  }
+
+  // Returns the cached prepared statement for `sql` or nullptr if there is no
+  // such statement of type `Prepared`. The returned pointer keeps the
+  // statement alive, even if it is evicted from the cache.
+  template <typename Prepared>
+  std::shared_ptr<Prepared> find(std::string_view sql) {
+    const auto it = _index.find(sql);
+    if (it == _index.end() or it->second->type != typeid(Prepared)) {
+      ++_stats.misses;
+      return nullptr;
+    }
+    ++_stats.hits;
+    ++it->second->hits;
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return std::static_pointer_cast<Prepared>(it->second->prepared);
+  }
+
+  // Adds the prepared statement to the cache (evicting the least recently
+  // used statements if necessary) and returns it. With a capacity of zero,
+  // nothing is cached, i.e. the statement is only kept alive by the returned
+  // pointer.
+  template <typename Prepared>
+  std::shared_ptr<Prepared> insert(std::string_view sql, Prepared prepared) {
+    auto result = std::make_shared<Prepared>(std::move(prepared));
+    if (_capacity == 0) {
+      return result;
+    }
+    if (const auto it = _index.find(sql); it != _index.end()) {
+      _erase(it);
+    }
+    while (not _entries.empty() and _entries.size() >= _capacity) {
+      _erase(_index.find(_entries.back().sql));
+      ++_stats.evictions;
+    }
+    _entries.push_front(entry{
+        .sql = std::string{sql}, .type = typeid(Prepared), .prepared = result});
+    _index.emplace(_entries.front().sql, _entries.begin());
+    return result;
+  }
+
+  void clear() {
+    _index.clear();
+    _entries.clear();
+  }
+
+ private:
+  void _erase(
+      std::unordered_map<std::string_view,
+                         std::list<entry>::iterator>::iterator it) {
+    const auto entry_it = it->second;
+    _index.erase(it);
+    _entries.erase(entry_it);
+  }
+};
+}  // namespace sqlpp::detail
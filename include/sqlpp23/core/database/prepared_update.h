@@ -56,7 +56,10 @@ struct prepared_update_t {
     return statement_handler_t{}.run_prepared_insert(*this, db);
   }
 
-  void _bind_parameters() { parameters._bind(_prepared_statement); }
+  void _bind_parameters() {
+    parameters._bind(_prepared_statement,
+                     _prepared_statement._active_parameters);
+  }
 
   _prepared_statement_t _prepared_statement;
 };
@@ -29,18 +29,24 @@
 
 #include <sqlpp23/core/chrono.h>
 
-#include <cctype>
-
 namespace sqlpp::detail {
-inline bool parse_unsigned(int& value, const char*& input, int length) {
+// Locale independent replacement for std::isdigit (a single comparison).
+inline bool is_digit(char ch) {
+  return static_cast<unsigned char>(ch - '0') <= 9;
+}
+
+// Parses exactly `Length` digits. Stops at the first non-digit, e.g. the
+// terminating null character.
+template <int Length>
+inline bool parse_unsigned(int& value, const char*& input) {
   value = 0;
   auto new_input = input;
-  while (length--) {
-    auto ch = *new_input++;
-    if (std::isdigit(ch) == false) {
+  for (int i = 0; i < Length; ++i) {
+    const auto ch = *new_input++;
+    if (is_digit(ch) == false) [[unlikely]] {
       return false;
     }
-    value = value * 10 + ch - '0';
+    value = value * 10 + (ch - '0');
   }
   input = new_input;
   return true;
@@ -57,11 +63,11 @@ inline bool parse_character(const char*& input, char ch) {
 inline bool parse_yyyy_mm_dd(std::chrono::sys_days& dp, const char*& input) {
   auto new_input = input;
   int year, month, day;
-  if ((parse_unsigned(year, new_input, 4) == false) ||
+  if ((parse_unsigned<4>(year, new_input) == false) ||
       (parse_character(new_input, '-') == false) ||
-      (parse_unsigned(month, new_input, 2) == false) ||
+      (parse_unsigned<2>(month, new_input) == false) ||
       (parse_character(new_input, '-') == false) ||
-      (parse_unsigned(day, new_input, 2) == false)) {
+      (parse_unsigned<2>(day, new_input) == false)) {
     return false;
   }
   dp = std::chrono::year{year} / month / day;
@@ -72,11 +78,11 @@ inline bool parse_yyyy_mm_dd(std::chrono::sys_days& dp, const char*& input) {
 inline bool parse_hh_mm_ss(std::chrono::microseconds& us, const char*& input) {
   auto new_input = input;
   int hour, minute, second;
-  if ((parse_unsigned(hour, new_input, 2) == false) ||
+  if ((parse_unsigned<2>(hour, new_input) == false) ||
       (parse_character(new_input, ':') == false) ||
-      (parse_unsigned(minute, new_input, 2) == false) ||
+      (parse_unsigned<2>(minute, new_input) == false) ||
       (parse_character(new_input, ':') == false) ||
-      (parse_unsigned(second, new_input, 2) == false)) {
+      (parse_unsigned<2>(second, new_input) == false)) {
     return false;
   }
   // Strings that have valid format but year, month and/or day values that fall
@@ -98,7 +104,7 @@ inline bool parse_ss_fraction(std::chrono::microseconds& us,
   int value = 0;
   int len_max = 6;
   int len_actual;
-  for (len_actual = 0; (len_actual < len_max) && std::isdigit(*new_input);
+  for (len_actual = 0; (len_actual < len_max) && is_digit(*new_input);
        ++len_actual, ++new_input) {
     value = value * 10 + *new_input - '0';
   }
@@ -124,21 +130,21 @@ inline bool parse_tz(std::chrono::microseconds& offset, const char*& input) {
     return false;
   }
   int hour;
-  if (parse_unsigned(hour, new_input, 2) == false) {
+  if (parse_unsigned<2>(hour, new_input) == false) {
     return false;
   }
   offset = tz_sign * std::chrono::hours{hour};
   input = new_input;
   int minute;
   if ((parse_character(new_input, ':') == false) ||
-      (parse_unsigned(minute, new_input, 2) == false)) {
+      (parse_unsigned<2>(minute, new_input) == false)) {
     return true;
   }
   offset += tz_sign * std::chrono::minutes{minute};
   input = new_input;
   int second;
   if ((parse_character(new_input, ':') == false) ||
-      (parse_unsigned(second, new_input, 2) == false)) {
+      (parse_unsigned<2>(second, new_input) == false)) {
     return true;
   }
   offset += tz_sign * std::chrono::seconds{second};
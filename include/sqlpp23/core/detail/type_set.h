@@ -32,7 +32,9 @@
 #include <sqlpp23/core/name/name_tag.h>
 #include <sqlpp23/core/wrong.h>
 #include <stddef.h>
+#include <array>
 #include <type_traits>
+#include <utility>
 
 namespace sqlpp::detail {
 // some forward declarations and helpers
@@ -108,28 +110,111 @@ struct is_element_of<E, type_set<Elements...>> {
   static constexpr bool value = type_set<Elements...>::template count<E>();
 };
 
-template <>
-struct make_type_set<> {
-  using type = type_set<>;
+// Type sets are computed in a single step instead of inserting elements one
+// by one. The latter instantiates a growing type_set for each element, which
+// dominates the compile time of large statements.
+template <size_t I, typename T>
+struct _indexed_base : _base<T> {};
+
+template <typename Indices, typename... T>
+struct _indexed_bases;
+
+template <size_t... Is, typename... T>
+struct _indexed_bases<std::index_sequence<Is...>, T...>
+    : _indexed_base<Is, T>... {};
+
+template <size_t I, typename T>
+std::type_identity<T> _type_at(const _indexed_base<I, T>&);
+
+// Identifies types in constant expressions.
+template <typename T>
+inline constexpr char _type_id = 0;
+
+template <typename T>
+inline constexpr bool _always = true;
+
+template <size_t N>
+struct _selection {
+  std::array<size_t, N> indices{};
+  size_t size = 0;
 };
 
-template <typename T, typename... Rest>
-struct make_type_set<T, Rest...> {
-  using type = typename make_type_set<Rest...>::type::template insert<T>::type;
+// Selects the last occurrence of each candidate, in order or reversed.
+template <bool Reverse, size_t N>
+constexpr _selection<N> _select_last_occurrences(
+    const std::array<const void*, N>& ids,
+    const std::array<bool, N>& candidates,
+    bool unique) {
+  _selection<N> selection;
+  for (size_t k = 0; k < N; ++k) {
+    const size_t i = Reverse ? N - 1 - k : k;
+    if (not candidates[i]) {
+      continue;
+    }
+    bool is_last = true;
+    for (size_t j = i + 1; not unique and j < N; ++j) {
+      if (ids[j] == ids[i]) {
+        is_last = false;
+        break;
+      }
+    }
+    if (is_last) {
+      selection.indices[selection.size++] = i;
+    }
+  }
+  return selection;
+}
+
+template <typename... T>
+struct _type_list {
+  using _bases = _indexed_bases<std::index_sequence_for<T...>, T...>;
+
+  // A base that is inherited more than once is ambiguous.
+  static constexpr bool _unique = ::sqlpp::logic::all<
+      std::is_convertible<_bases*, _base<T>*>::value...>::value;
+
+  template <size_t I>
+  using at = typename decltype(_type_at<I>(std::declval<const _bases&>()))::type;
+
+  template <bool Reverse, bool... Candidates>
+  struct select {
+    static constexpr auto _selection =
+        _select_last_occurrences<Reverse, sizeof...(T)>(
+            {static_cast<const void*>(&_type_id<T>)...}, {Candidates...},
+            _unique);
+
+    template <size_t... Is>
+    static auto _make(std::index_sequence<Is...>)
+        -> type_set<at<_selection.indices[Is]>...>;
+
+    using type = decltype(_make(std::make_index_sequence<_selection.size>{}));
+  };
 };
 
-template <template <typename> class Predicate, typename... T>
-struct make_type_set_if;
+template <bool Unique, typename... T>
+struct _make_type_set {
+  using type = type_set<T...>;
+};
 
-template <template <typename> class Predicate>
-struct make_type_set_if<Predicate> {
-  using type = type_set<>;
+template <typename... T>
+struct _make_type_set<false, T...> {
+  using type = typename _type_list<T...>::template select<
+false, _always<T>...>::type;
+};
+
+// Keeps the last occurrence of duplicate elements.
+template <typename... T>
+struct make_type_set {
+  using type =
+      typename _make_type_set<_type_list<T...>::_unique, T...>::type;
 };
 
-template <template <typename> class Predicate, typename T, typename... Rest>
-struct make_type_set_if<Predicate, T, Rest...> {
-  using type = typename make_type_set_if<Predicate, Rest...>::type::
-      template insert_if<Predicate, T>::type;
+// Yields the elements satisfying the predicate in reverse order.
+template <template <typename> class Predicate, typename... T>
+struct make_type_set_if {
+  using type = typename _type_list<T...>::template select<
+      true,
+      static_cast<bool>(Predicate<T>::value)...>::type;
 };
 
 template <template <typename> class Predicate, typename... T>
@@ -149,7 +234,7 @@ using make_type_set_if_not_t =
 
 template <typename... T>
 using has_duplicates =
-    std::integral_constant<bool, make_type_set_t<T...>::size() != sizeof...(T)>;
+    std::integral_constant<bool, not _type_list<T...>::_unique>;
 
 template <typename... T>
 struct make_joined_set {
@@ -167,9 +252,37 @@ struct make_joined_set<type_set<Es...>> {
   using type = type_set<Es...>;
 };
 
+template <typename... Ls>
+struct make_joined_set<type_set<Ls...>, type_set<>> {
+  using type = make_type_set_t<Ls...>;
+};
+
+template <typename... Rs>
+struct make_joined_set<type_set<>, type_set<Rs...>> {
+  using type = type_set<Rs...>;
+};
+
+template <>
+struct make_joined_set<type_set<>, type_set<>> {
+  using type = type_set<>;
+};
+
+template <typename Lhs, typename Rhs>
+struct _concat_sets;
+
+template <typename... Ls, typename... Rs>
+struct _concat_sets<type_set<Ls...>, type_set<Rs...>> {
+  using type = type_set<Ls..., Rs...>;
+};
+
+// Elements of the left set that are not in the right set, followed by the
+// right set.
 template <typename... Ls, typename... Rs>
 struct make_joined_set<type_set<Ls...>, type_set<Rs...>> {
-  using type = make_type_set_t<Ls..., Rs...>;
+  using _lhs_only = typename _type_list<Ls...>::template select<
+      false,
+      not type_set<Rs...>::template count<Ls>()...>::type;
+  using type = typename _concat_sets<_lhs_only, type_set<Rs...>>::type;
 };
 
 template <typename... E, typename... T>
@@ -190,9 +303,9 @@ struct make_difference_set {
 
 template <typename... Minuends, typename... Subtrahends>
 struct make_difference_set<type_set<Minuends...>, type_set<Subtrahends...>> {
-  template <typename E>
-  using is_subtrahend = is_element_of<E, type_set<Subtrahends...>>;
-  using type = make_type_set_if_not_t<is_subtrahend, Minuends...>;
+  using type = typename _type_list<Minuends...>::template select<
+      true,
+      not type_set<Subtrahends...>::template count<Minuends>()...>::type;
 };
 
 template <typename Minuend, typename Subtrahend>
@@ -207,11 +320,9 @@ struct make_intersect_set {
 
 template <typename... LhsElements, typename... RhsElements>
 struct make_intersect_set<type_set<LhsElements...>, type_set<RhsElements...>> {
-  template <typename E>
-  using is_in_both =
-      ::sqlpp::logic::all<type_set<LhsElements...>::template count<E>(),
-                          type_set<RhsElements...>::template count<E>()>;
-  using type = make_type_set_if_t<is_in_both, LhsElements...>;
+  using type = typename _type_list<LhsElements...>::template select<
+      true,
+      type_set<RhsElements...>::template count<LhsElements>()...>::type;
 };
 
 template <typename Lhs, typename Rhs>
@@ -233,9 +344,7 @@ using transform_set_t = typename transform_set<T, Transformation>::type;
 
 template <typename... T>
 struct are_unique
-    : public std::integral_constant<bool,
-                                    make_type_set_t<T...>::size() ==
-                                        sizeof...(T)> {};
+    : public std::integral_constant<bool, _type_list<T...>::_unique> {};
 
 template <typename... T>
 struct are_same
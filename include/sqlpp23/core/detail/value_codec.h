@@ -0,0 +1,307 @@
+#pragma once
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+// Conversion of numbers, dates, and times to and from text, e.g. for
+// serializing statements, binding text parameters, and reading text results.
+//
+// Based on std::to_chars and std::from_chars, i.e. locale independent and
+// without allocations. The `*_to_chars` functions behave like std::to_chars:
+// They write into [first, last) and report value_too_large if the range is too
+// small. The `append_*` functions append to a string.
+namespace sqlpp::detail {
+// Formatted values (e.g. timestamps with up to microsecond precision) fit into
+// buffers of this size.
+inline constexpr size_t max_formatted_size = 64;
+
+// Fallback for values that are not covered by the fast paths below.
+template <typename... Args>
+auto format_to_chars(char* first,
+                     char* last,
+                     std::format_string<const Args&...> fmt,
+                     const Args&... args) -> std::to_chars_result {
+  const auto result = std::format_to_n(first, last - first, fmt, args...);
+  if (std::cmp_greater(result.size, last - first)) {
+    return {last, std::errc::value_too_large};
+  }
+  return {result.out, std::errc{}};
+}
+
+// Writes `value` with exactly `Width` digits (left-padded with zeros).
+template <size_t Width>
+constexpr auto write_fixed_digits(char* out, uint64_t value) -> char* {
+  for (size_t i = Width; i > 0; --i) {
+    out[i - 1] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return out + Width;
+}
+
+template <typename T>
+  requires(std::is_integral_v<T>)
+auto integral_to_chars(char* first, char* last, T value)
+    -> std::to_chars_result {
+  if constexpr (std::is_same_v<T, bool>) {
+    if (first == last) {
+      return {last, std::errc::value_too_large};
+    }
+    *first = value ? '1' : '0';
+    return {first + 1, std::errc{}};
+  } else {
+    return std::to_chars(first, last, value);
+  }
+}
+
+// Same as std::format("{:.{}g}", value, std::numeric_limits<T>::digits10).
+template <typename T>
+  requires(std::is_floating_point_v<T>)
+auto floating_point_to_chars(char* first, char* last, T value)
+    -> std::to_chars_result {
+  return std::to_chars(first, last, value, std::chars_format::general,
+                       std::numeric_limits<T>::digits10);
+}
+
+// Same as std::format("{0:%Y-%m-%d}", value).
+inline auto date_to_chars(char* first,
+                          char* last,
+                          const std::chrono::sys_days& value)
+    -> std::to_chars_result {
+  const auto ymd = std::chrono::year_month_day{value};
+  const auto year = static_cast<int>(ymd.year());
+  if (year < 0 or year > 9999) [[unlikely]] {
+    return format_to_chars(first, last, "{0:%Y-%m-%d}", value);
+  }
+  if (last - first < 10) {
+    return {last, std::errc::value_too_large};
+  }
+  auto out = write_fixed_digits<4>(first, static_cast<uint64_t>(year));
+  *out++ = '-';
+  out = write_fixed_digits<2>(out, static_cast<unsigned>(ymd.month()));
+  *out++ = '-';
+  out = write_fixed_digits<2>(out, static_cast<unsigned>(ymd.day()));
+  return {out, std::errc{}};
+}
+
+// Same as std::format("{0:%H:%M:%S}", value), i.e. with as many fractional
+// digits as required by the precision of the duration.
+template <typename Rep, typename Period>
+auto time_of_day_to_chars(char* first,
+                          char* last,
+                          const std::chrono::duration<Rep, Period>& value)
+    -> std::to_chars_result {
+  using _duration_t = std::chrono::duration<Rep, Period>;
+  using _hh_mm_ss_t = std::chrono::hh_mm_ss<_duration_t>;
+  constexpr auto fractional_width = _hh_mm_ss_t::fractional_width;
+  if constexpr (std::is_floating_point_v<Rep> or fractional_width > 9) {
+    return format_to_chars(first, last, "{0:%H:%M:%S}", value);
+  } else {
+    const auto is_time_of_day =
+        value >= _duration_t::zero() and value < std::chrono::days{1};
+    if (not is_time_of_day) [[unlikely]] {
+      return format_to_chars(first, last, "{0:%H:%M:%S}", value);
+    }
+    constexpr auto size =
+        8 + (fractional_width > 0 ? 1 + fractional_width : 0);
+    if (last - first < static_cast<std::ptrdiff_t>(size)) {
+      return {last, std::errc::value_too_large};
+    }
+    const auto hms = _hh_mm_ss_t{value};
+    auto out = write_fixed_digits<2>(
+        first, static_cast<uint64_t>(hms.hours().count()));
+    *out++ = ':';
+    out = write_fixed_digits<2>(out,
+                                static_cast<uint64_t>(hms.minutes().count()));
+    *out++ = ':';
+    out = write_fixed_digits<2>(out,
+                                static_cast<uint64_t>(hms.seconds().count()));
+    if constexpr (fractional_width > 0) {
+      *out++ = '.';
+      out = write_fixed_digits<fractional_width>(
+          out, static_cast<uint64_t>(hms.subseconds().count()));
+    }
+    return {out, std::errc{}};
+  }
+}
+
+// Same as std::format("{0:%Y-%m-%d %H:%M:%S}", value) (with the given
+// separator between date and time).
+template <typename Duration>
+auto timestamp_to_chars(
+    char* first,
+    char* last,
+    const std::chrono::time_point<std::chrono::system_clock, Duration>& value,
+    char separator = ' ') -> std::to_chars_result {
+  const auto day = std::chrono::floor<std::chrono::days>(value);
+  auto result = date_to_chars(first, last, day);
+  if (result.ec != std::errc{}) {
+    return result;
+  }
+  if (result.ptr == last) {
+    return {last, std::errc::value_too_large};
+  }
+  *result.ptr++ = separator;
+  return time_of_day_to_chars(result.ptr, last, value - day);
+}
+
+// Appends the result of one of the `*_to_chars` functions above to `out`.
+template <typename ToChars>
+auto append_chars(std::string& out, const ToChars& to_chars) -> void {
+  auto buffer = std::array<char, max_formatted_size>{};
+  const auto result = to_chars(buffer.data(), buffer.data() + buffer.size());
+  out.append(buffer.data(), result.ptr);
+}
+
+template <typename T>
+  requires(std::is_integral_v<T>)
+auto append_integral(std::string& out, T value) -> void {
+  append_chars(out, [&](char* first, char* last) {
+    return integral_to_chars(first, last, value);
+  });
+}
+
+template <typename T>
+  requires(std::is_floating_point_v<T>)
+auto append_floating_point(std::string& out, T value) -> void {
+  append_chars(out, [&](char* first, char* last) {
+    return floating_point_to_chars(first, last, value);
+  });
+}
+
+inline auto append_date(std::string& out, const std::chrono::sys_days& value)
+    -> void {
+  append_chars(out, [&](char* first, char* last) {
+    return date_to_chars(first, last, value);
+  });
+}
+
+template <typename Rep, typename Period>
+auto append_time_of_day(std::string& out,
+                        const std::chrono::duration<Rep, Period>& value)
+    -> void {
+  append_chars(out, [&](char* first, char* last) {
+    return time_of_day_to_chars(first, last, value);
+  });
+}
+
+template <typename Duration>
+auto append_timestamp(
+    std::string& out,
+    const std::chrono::time_point<std::chrono::system_clock, Duration>& value,
+    char separator = ' ') -> void {
+  append_chars(out, [&](char* first, char* last) {
+    return timestamp_to_chars(first, last, value, separator);
+  });
+}
+
+// Returns the formatted number as a new string.
+template <typename T>
+  requires(std::is_arithmetic_v<T>)
+auto number_to_string(T value) -> std::string {
+  auto result = std::string{};
+  if constexpr (std::is_floating_point_v<T>) {
+    append_floating_point(result, value);
+  } else {
+    append_integral(result, value);
+  }
+  return result;
+}
+
+// Parses a number from the beginning of `text`, which does not need to be
+// null-terminated, with the semantics of std::strtoll and friends: Leading
+// whitespace and a `+` sign are skipped, negative numbers wrap around for
+// unsigned types, and numbers out of range are clamped. Invalid input yields
+// zero. Returns false for invalid input and numbers out of range.
+template <typename T>
+  requires(std::is_arithmetic_v<T> and not std::is_same_v<T, bool>)
+auto parse_number(std::string_view text, T& value) -> bool {
+  const auto* first = text.data();
+  const auto* const last = text.data() + text.size();
+  // Whitespace as in the "C" locale.
+  while (first != last and
+         (*first == ' ' or (*first >= '\t' and *first <= '\r'))) {
+    ++first;
+  }
+  auto negative = false;
+  if (first != last and (*first == '+' or *first == '-')) {
+    negative = *first == '-';
+    // std::from_chars does not accept `+`, and `-` only for signed types.
+    if (*first == '+' or std::is_unsigned_v<T>) {
+      ++first;
+      if (first != last and (*first == '+' or *first == '-')) {
+        value = T{};
+        return false;
+      }
+    }
+  }
+
+  const auto result = std::from_chars(first, last, value);
+  if (result.ec == std::errc::invalid_argument) {
+    value = T{};
+    return false;
+  }
+  if (result.ec == std::errc::result_out_of_range) {
+    if constexpr (std::is_floating_point_v<T>) {
+      // Overflow or underflow, which std::from_chars does not tell apart.
+      const auto number = std::string(first, result.ptr);
+      if constexpr (std::is_same_v<T, float>) {
+        value = std::strtof(number.c_str(), nullptr);
+      } else if constexpr (std::is_same_v<T, double>) {
+        value = std::strtod(number.c_str(), nullptr);
+      } else {
+        value = std::strtold(number.c_str(), nullptr);
+      }
+    } else if constexpr (std::is_unsigned_v<T>) {
+      value = std::numeric_limits<T>::max();
+    } else {
+      value = negative ? std::numeric_limits<T>::min()
+                       : std::numeric_limits<T>::max();
+    }
+    return false;
+  }
+  if constexpr (std::is_unsigned_v<T>) {
+    if (negative) {
+      value = static_cast<T>(T{0} - value);
+    }
+  }
+  return true;
+}
+}  // namespace sqlpp::detail
@@ -65,13 +65,22 @@ struct nodes_of<coalesce_t<Expressions...>> {
   using type = detail::type_vector<Expressions...>;
 };
 
+template <typename Context, typename... Expressions>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const coalesce_t<Expressions...>& t) -> void {
+  out += "COALESCE(";
+  append_tuple_sql_string(context, out, read.expressions(t),
+                          tuple_operand{", "});
+  out += ')';
+}
+
 template <typename Context, typename... Expressions>
 auto to_sql_string(Context& context, const coalesce_t<Expressions...>& t)
     -> std::string {
-  return "COALESCE(" +
-         tuple_to_sql_string(context, read.expressions(t),
-                             tuple_operand{", "}) +
-         ")";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Arg, typename... Expressions>
@@ -58,8 +58,20 @@ struct nodes_of<trim_t<Expression>> {
 };
 
 template <typename Context, typename Expression>
-auto to_sql_string(Context& context, const trim_t<Expression>& t) -> std::string {
-  return std::format("TRIM({})", to_sql_string(context, read.expression(t)));
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const trim_t<Expression>& t) -> void {
+  out += "TRIM(";
+  append_sql_string(context, out, read.expression(t));
+  out += ')';
+}
+
+template <typename Context, typename Expression>
+auto to_sql_string(Context& context, const trim_t<Expression>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename T>
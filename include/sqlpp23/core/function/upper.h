@@ -56,8 +56,20 @@ struct nodes_of<upper_t<Expression>> {
 };
 
 template <typename Context, typename Expression>
-auto to_sql_string(Context& context, const upper_t<Expression>& t) -> std::string {
-  return "UPPER(" + to_sql_string(context, read.expression(t)) + ")";
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const upper_t<Expression>& t) -> void {
+  out += "UPPER(";
+  append_sql_string(context, out, read.expression(t));
+  out += ')';
+}
+
+template <typename Context, typename Expression>
+auto to_sql_string(Context& context, const upper_t<Expression>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Expression>
@@ -54,6 +54,10 @@ struct nodes_of<any_t<Select>> {
   using type = detail::type_vector<Select>;
 };
 
+template <typename Select>
+struct has_static_sql<any_t<Select>>
+    : public has_static_sql_nodes<any_t<Select>> {};
+
 template <typename T>
 struct remove_any {
   using type = T;
@@ -67,9 +71,20 @@ struct remove_any<any_t<Select>> {
 template <typename T>
 using remove_any_t = typename remove_any<T>::type;
 
+template <typename Context, typename Select>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const any_t<Select>& t) -> void {
+  out += "ANY (";
+  append_sql_string(context, out, read.expression(t));
+  out += ')';
+}
+
 template <typename Context, typename Select>
 auto to_sql_string(Context& context, const any_t<Select>& t) -> std::string {
-  return "ANY (" + to_sql_string(context, read.expression(t)) + ")";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Clauses>
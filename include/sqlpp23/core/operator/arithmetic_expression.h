@@ -428,17 +428,31 @@ struct nodes_of<arithmetic_expression<Lhs, Operator, Rhs>> {
   using type = detail::type_vector<Lhs, Rhs>;
 };
 
+template <typename Lhs, typename Operator, typename Rhs>
+struct has_static_sql<arithmetic_expression<Lhs, Operator, Rhs>>
+    : public has_static_sql_nodes<arithmetic_expression<Lhs, Operator, Rhs>> {};
+
 template <typename Lhs, typename Operator, typename Rhs>
 struct requires_parentheses<arithmetic_expression<Lhs, Operator, Rhs>>
     : public std::true_type {};
 
+template <typename Context, typename Lhs, typename Operator, typename Rhs>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const arithmetic_expression<Lhs, Operator, Rhs>& t)
+    -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += Operator::symbol;
+  append_operand_sql_string(context, out, read.rhs(t));
+}
+
 template <typename Context, typename Lhs, typename Operator, typename Rhs>
 auto to_sql_string(Context& context,
                    const arithmetic_expression<Lhs, Operator, Rhs>& t)
     -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = operand_to_sql_string(context, read.lhs(t)) + Operator::symbol;
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Lhs, typename Rhs>
@@ -63,15 +63,29 @@ struct nodes_of<as_expression<Expression, NameTag>> {
   using type = detail::type_vector<Expression>;
 };
 
+template <typename Expression, typename NameTag>
+struct has_static_sql<as_expression<Expression, NameTag>>
+    : public has_static_sql_nodes<as_expression<Expression, NameTag>> {};
+
 template <typename Expression, typename NameTag>
 struct is_as_expression<as_expression<Expression, NameTag>>
     : public std::true_type {};
 
+template <typename Context, typename Expression, typename NameTag>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const as_expression<Expression, NameTag>& t) -> void {
+  append_operand_sql_string(context, out, read.expression(t));
+  out += " AS ";
+  append_name_sql_string(context, out, NameTag{});
+}
+
 template <typename Context, typename Expression, typename NameTag>
 auto to_sql_string(Context& context,
                    const as_expression<Expression, NameTag>& t) -> std::string {
-  return operand_to_sql_string(context, read.expression(t)) + " AS " +
-         name_to_sql_string(context, NameTag{});
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Expr, typename NameTagProvider>
@@ -81,6 +81,10 @@ struct nodes_of<assign_expression<Lhs, Operator, Rhs>> {
   using type = detail::type_vector<Lhs, Rhs>;
 };
 
+template <typename Lhs, typename Operator, typename Rhs>
+struct has_static_sql<assign_expression<Lhs, Operator, Rhs>>
+    : public has_static_sql_nodes<assign_expression<Lhs, Operator, Rhs>> {};
+
 template <typename Lhs, typename Operator, typename Rhs>
 struct lhs<assign_expression<Lhs, Operator, Rhs>> {
   using type = Lhs;
@@ -92,10 +96,21 @@ struct rhs<assign_expression<Lhs, Operator, Rhs>> {
 };
 
 template <typename Context, typename Lhs, typename Operator, typename Rhs>
-auto to_sql_string(Context& context, const assign_expression<Lhs, Operator, Rhs>& t)
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const assign_expression<Lhs, Operator, Rhs>& t) -> void {
+  append_sql_string(context, out, simple_column(read.lhs(t)));
+  out += Operator::symbol;
+  append_operand_sql_string(context, out, read.rhs(t));
+}
+
+template <typename Context, typename Lhs, typename Operator, typename Rhs>
+auto to_sql_string(Context& context,
+                   const assign_expression<Lhs, Operator, Rhs>& t)
     -> std::string {
-  return to_sql_string(context, simple_column(read.lhs(t))) + Operator::symbol +
-         operand_to_sql_string(context, read.rhs(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 struct op_assign {
@@ -63,17 +63,33 @@ struct nodes_of<between_expression<Expression, Lhs, Rhs>> {
   using type = detail::type_vector<Expression, Lhs, Rhs>;
 };
 
+template <typename Expression, typename Lhs, typename Rhs>
+struct has_static_sql<between_expression<Expression, Lhs, Rhs>>
+    : public has_static_sql_nodes<between_expression<Expression, Lhs, Rhs>> {};
+
 template <typename Expression, typename Lhs, typename Rhs>
 struct requires_parentheses<between_expression<Expression, Lhs, Rhs>>
     : public std::true_type {};
 
 template <typename Context, typename Expression, typename Lhs, typename Rhs>
-auto to_sql_string(Context& context, const between_expression<Expression, Lhs, Rhs>& t)
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const between_expression<Expression, Lhs, Rhs>& t)
+    -> void {
+  append_operand_sql_string(context, out, read.expression(t));
+  out += " BETWEEN ";
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += " AND ";
+  append_operand_sql_string(context, out, read.rhs(t));
+}
+
+template <typename Context, typename Expression, typename Lhs, typename Rhs>
+auto to_sql_string(Context& context,
+                   const between_expression<Expression, Lhs, Rhs>& t)
     -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = operand_to_sql_string(context, read.expression(t)) + " BETWEEN ";
-  ret_val += operand_to_sql_string(context, read.lhs(t)) + " AND ";
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 }  // namespace sqlpp
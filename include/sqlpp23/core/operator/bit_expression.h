@@ -63,16 +63,29 @@ struct nodes_of<bit_expression<Lhs, Operator, Rhs>> {
   using type = detail::type_vector<Lhs, Rhs>;
 };
 
+template <typename Lhs, typename Operator, typename Rhs>
+struct has_static_sql<bit_expression<Lhs, Operator, Rhs>>
+    : public has_static_sql_nodes<bit_expression<Lhs, Operator, Rhs>> {};
+
 template <typename Lhs, typename Operator, typename Rhs>
 struct requires_parentheses<bit_expression<Lhs, Operator, Rhs>>
     : public std::true_type {};
 
 template <typename Context, typename Lhs, typename Operator, typename Rhs>
-auto to_sql_string(Context& context, const bit_expression<Lhs, Operator, Rhs>& t)
-    -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = operand_to_sql_string(context, read.lhs(t)) + Operator::symbol;
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const bit_expression<Lhs, Operator, Rhs>& t) -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += Operator::symbol;
+  append_operand_sql_string(context, out, read.rhs(t));
+}
+
+template <typename Context, typename Lhs, typename Operator, typename Rhs>
+auto to_sql_string(Context& context,
+                   const bit_expression<Lhs, Operator, Rhs>& t) -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 struct bit_and {
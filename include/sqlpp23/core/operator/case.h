@@ -108,12 +108,22 @@ struct nodes_of<when_then_pair_t<When, Then>> {
   using type = detail::type_vector<When, Then>;
 };
 
+template <typename Context, typename When, typename Then>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const when_then_pair_t<When, Then>& t) -> void {
+  out += " WHEN ";
+  append_operand_sql_string(context, out, read.when(t));
+  out += " THEN ";
+  append_operand_sql_string(context, out, read.then(t));
+}
+
 template <typename Context, typename When, typename Then>
 auto to_sql_string(Context& context, const when_then_pair_t<When, Then>& t)
     -> std::string {
-  // Temporary result to enforce order of evaluation.
-  auto result = " WHEN " + operand_to_sql_string(context, read.when(t));
-  return result + " THEN " + operand_to_sql_string(context, read.then(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 // RepresentativeExpression is an expression that has the same data type as the
@@ -157,6 +167,22 @@ struct requires_parentheses<
     case_t<RepresentativeExpression, Else, WhenThenPairs...>>
     : public std::true_type {};
 
+template <typename Context,
+          typename RepresentativeExpression,
+          typename Else,
+          typename... WhenThenPairs>
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const case_t<RepresentativeExpression, Else, WhenThenPairs...>& t) -> void {
+  out += "CASE";
+  ::sqlpp::append_tuple_sql_string(context, out, read.when_then_list(t),
+                                   ::sqlpp::tuple_clause{""});
+  out += " ELSE ";
+  append_operand_sql_string(context, out, read.else_(t));
+  out += " END";
+}
+
 template <typename Context,
           typename RepresentativeExpression,
           typename Else,
@@ -165,12 +191,9 @@ auto to_sql_string(
     Context& context,
     const case_t<RepresentativeExpression, Else, WhenThenPairs...>& t)
     -> std::string {
-  std::string ret_val = "CASE";
-  ret_val += ::sqlpp::tuple_to_sql_string(context, read.when_then_list(t),
-                                          ::sqlpp::tuple_clause{""});
-  ret_val += " ELSE " + operand_to_sql_string(context, read.else_(t));
-  ret_val += " END";
-  return ret_val;
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 // RepresentativeExpression is an expression that has the same data type as the
@@ -60,13 +60,27 @@ struct nodes_of<cast_t<Expression, DataType>> {
   using type = detail::type_vector<Expression, DataType>;
 };
 
+template <typename Expression, typename DataType>
+struct has_static_sql<cast_t<Expression, DataType>>
+    : public has_static_sql_nodes<cast_t<Expression, DataType>> {};
+
+template <typename Context, typename Expression, typename DataType>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const cast_t<Expression, DataType>& t) -> void {
+  out += "CAST(";
+  append_operand_sql_string(context, out, read.expression(t));
+  out += " AS ";
+  out += data_type_to_sql_string(context, DataType{});
+  out += ')';
+}
+
 template <typename Context, typename Expression, typename DataType>
 auto to_sql_string(Context& context, const cast_t<Expression, DataType>& t)
     -> std::string {
-  return std::format(
-      "CAST({} AS {})",
-      operand_to_sql_string(context, read.expression(t)),
-      data_type_to_sql_string(context, DataType{}));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename DataType>
@@ -62,10 +62,25 @@ struct nodes_of<exists_expression<Select>> {
   using type = detail::type_vector<Select>;
 };
 
+template <typename Select>
+struct has_static_sql<exists_expression<Select>>
+    : public has_static_sql_nodes<exists_expression<Select>> {};
+
+template <typename Context, typename Select>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const exists_expression<Select>& t) -> void {
+  out += "EXISTS (";
+  append_sql_string(context, out, read.expression(t));
+  out += ')';
+}
+
 template <typename Context, typename Select>
 auto to_sql_string(Context& context, const exists_expression<Select>& t)
     -> std::string {
-  return "EXISTS (" + to_sql_string(context, read.expression(t)) + ")";
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <typename... Clauses>
@@ -99,21 +99,37 @@ struct nodes_of<in_expression<L, Operator, std::tuple<Args...>>> {
   using type = detail::type_vector<L, Args...>;
 };
 
+template <typename L, typename Operator, typename... Args>
+struct has_static_sql<in_expression<L, Operator, std::tuple<Args...>>>
+    : public has_static_sql_nodes<
+          in_expression<L, Operator, std::tuple<Args...>>> {};
+
 template <typename L, typename Operator, typename... Args>
 struct requires_parentheses<in_expression<L, Operator, std::tuple<Args...>>>
     : public std::true_type {};
 
 template <typename Context, typename L, typename Operator, typename... Args>
-auto to_sql_string(Context& context,
-                   const in_expression<L, Operator, std::tuple<Args...>>& t)
-    -> std::string {
-  auto result = operand_to_sql_string(context, read.lhs(t)) + Operator::symbol + " (";
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const in_expression<L, Operator, std::tuple<Args...>>& t)
+    -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += Operator::symbol;
+  out += " (";
   if (sizeof...(Args) == 1) {
-    result += to_sql_string(context, std::get<0>(read.rhs(t)));
+    append_sql_string(context, out, std::get<0>(read.rhs(t)));
   } else {
-    result += tuple_to_sql_string(context, read.rhs(t), tuple_operand{", "});
+    append_tuple_sql_string(context, out, read.rhs(t), tuple_operand{", "});
   }
-  result += ")";
+  out += ')';
+}
+
+template <typename Context, typename L, typename Operator, typename... Args>
+auto to_sql_string(Context& context,
+                   const in_expression<L, Operator, std::tuple<Args...>>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
   return result;
 }
 
@@ -121,26 +137,37 @@ template <typename Container>
 struct value_list_t;
 
 template <typename Context, typename L, typename Operator, typename R>
-auto to_sql_string(Context& context,
-                   const in_expression<L, Operator, std::vector<R>>& t)
-    -> std::string {
-  auto result = to_sql_string(context, read.lhs(t)) + Operator::symbol + " (";
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const in_expression<L, Operator, std::vector<R>>& t)
+    -> void {
+  append_sql_string(context, out, read.lhs(t));
+  out += Operator::symbol;
+  out += " (";
   bool first = true;
   for (const auto& entry : read.rhs(t)) {
     if (first) {
       first = false;
     } else {
-      result += ", ";
+      out += ", ";
     }
 
     if (read.rhs(t).size() == 1) {
       // A single entry does not need extra parentheses.
-      result += to_sql_string(context, entry);
+      append_sql_string(context, out, entry);
     } else {
-      result += operand_to_sql_string(context, entry);
+      append_operand_sql_string(context, out, entry);
     }
   }
-  result += ")";
+  out += ')';
+}
+
+template <typename Context, typename L, typename Operator, typename R>
+auto to_sql_string(Context& context,
+                   const in_expression<L, Operator, std::vector<R>>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
   return result;
 }
 
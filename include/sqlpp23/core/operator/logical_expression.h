@@ -74,31 +74,38 @@ struct nodes_of<logical_expression<Lhs, Operator, Rhs>> {
   using type = detail::type_vector<Lhs, Rhs>;
 };
 
+template <typename Lhs, typename Operator, typename Rhs>
+struct has_static_sql<logical_expression<Lhs, Operator, Rhs>>
+    : public has_static_sql_nodes<logical_expression<Lhs, Operator, Rhs>> {};
+
 template <typename Lhs, typename Operator, typename Rhs>
 struct requires_parentheses<logical_expression<Lhs, Operator, Rhs>>
     : public std::true_type {};
 
 template <typename Context, typename Lhs, typename Operator, typename Rhs>
-auto to_sql_string(Context& context,
-                   const logical_expression<Lhs, Operator, Rhs>& t)
-    -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = operand_to_sql_string(context, read.lhs(t)) + Operator::symbol;
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const logical_expression<Lhs, Operator, Rhs>& t)
+    -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += Operator::symbol;
+  append_operand_sql_string(context, out, read.rhs(t));
 }
 
 template <typename Context, typename Lhs, typename Operator, typename Rhs>
-auto to_sql_string(Context& context,
-                   const logical_expression<Lhs, Operator, dynamic_t<Rhs>>& t)
-    -> std::string {
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const logical_expression<Lhs, Operator, dynamic_t<Rhs>>& t) -> void {
   if (read.rhs(t).has_value()) {
-    // Note: Temporary required to enforce parameter ordering.
-    auto ret_val = operand_to_sql_string(context, read.lhs(t)) + Operator::symbol;
-    return ret_val + operand_to_sql_string(context, read.rhs(t).value());
+    append_operand_sql_string(context, out, read.lhs(t));
+    out += Operator::symbol;
+    append_operand_sql_string(context, out, read.rhs(t).value());
+    return;
   }
 
   // If the dynamic part is inactive ignore it.
-  return to_sql_string(context, read.lhs(t));
+  append_sql_string(context, out, read.lhs(t));
 }
 
 template <typename Context,
@@ -106,14 +113,15 @@ template <typename Context,
           typename Operator,
           typename R1,
           typename R2>
-auto to_sql_string(
+auto append_sql_string(
     Context& context,
+    std::string& out,
     const logical_expression<logical_expression<Lhs, Operator, R1>,
                              Operator,
-                             R2>& t) -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = to_sql_string(context, read.lhs(t)) + Operator::symbol;
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+                             R2>& t) -> void {
+  append_sql_string(context, out, read.lhs(t));
+  out += Operator::symbol;
+  append_operand_sql_string(context, out, read.rhs(t));
 }
 
 template <typename Context,
@@ -121,19 +129,30 @@ template <typename Context,
           typename Operator,
           typename R1,
           typename R2>
-auto to_sql_string(
+auto append_sql_string(
     Context& context,
+    std::string& out,
     const logical_expression<logical_expression<Lhs, Operator, R1>,
                              Operator,
-                             dynamic_t<R2>>& t) -> std::string {
+                             dynamic_t<R2>>& t) -> void {
   if (read.rhs(t).has_value()) {
-    // Note: Temporary required to enforce parameter ordering.
-    auto ret_val = to_sql_string(context, read.lhs(t)) + Operator::symbol;
-    return ret_val + operand_to_sql_string(context, read.rhs(read.rhs(t).value()));
+    append_sql_string(context, out, read.lhs(t));
+    out += Operator::symbol;
+    append_operand_sql_string(context, out, read.rhs(t).value());
+    return;
   }
 
   // If the dynamic part is inactive ignore it.
-  return to_sql_string(context, read.lhs(t));
+  append_sql_string(context, out, read.lhs(t));
+}
+
+template <typename Context, typename Lhs, typename Operator, typename Rhs>
+auto to_sql_string(Context& context,
+                   const logical_expression<Lhs, Operator, Rhs>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 template <StaticBoolean Lhs, DynamicBoolean Rhs>
@@ -64,10 +64,20 @@ auto to_sql_string(Context&, const sort_type& t) -> std::string {
   return " DESC";
 }
 
+template <typename Context, typename L>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const sort_order_expression<L>& t) -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += to_sql_string(context, read.rhs(t));
+}
+
 template <typename Context, typename L>
 auto to_sql_string(Context& context, const sort_order_expression<L>& t)
     -> std::string {
-  return operand_to_sql_string(context, read.lhs(t)) + to_sql_string(context, read.rhs(t));
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
 }
 
 }  // namespace sqlpp
@@ -102,8 +102,7 @@ template <typename Expr>
   requires((has_data_type<Expr>::value or is_raw_select_flag<Expr>::value or
             is_as_expression<Expr>::value or is_assignment<Expr>::value or
             is_table<Expr>::value or is_sort_order<Expr>::value or
-            is_statement<Expr>::value) and
-           parameters_of_t<Expr>::empty())
+            is_statement<Expr>::value))
 auto dynamic(std::optional<Expr> t) -> dynamic_t<Expr> {
   return {std::move(t)};
 }
@@ -113,8 +112,7 @@ template <typename Expr>
   requires((has_data_type<Expr>::value or is_raw_select_flag<Expr>::value or
             is_as_expression<Expr>::value or is_assignment<Expr>::value or
             is_table<Expr>::value or is_sort_order<Expr>::value or
-            is_statement<Expr>::value) and
-           parameters_of_t<Expr>::empty())
+            is_statement<Expr>::value))
 auto dynamic(bool condition, Expr t) -> dynamic_t<Expr> {
   if (condition) {
     return {std::move(t)};
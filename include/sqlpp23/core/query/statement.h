@@ -278,6 +278,10 @@ template <typename... Clauses>
 struct nodes_of<statement_t<Clauses...>> : public no_nodes {
 };
 
+template <typename... Clauses>
+struct has_static_sql<statement_t<Clauses...>>
+    : public logic::all<has_static_sql<Clauses>::value...> {};
+
 template <typename Context, typename... Clauses>
 struct compatibility_check<Context, statement_t<Clauses...>> {
   using type = compatibility_check_t<Context, detail::type_vector<Clauses...>>;
@@ -433,13 +437,19 @@ constexpr auto operator<<(statement_t<LClauses...> l, Clause r)
   return _core_statement(statement_constructor_arg(std::move(l), std::move(r)));
 }
 
+template <typename Context, typename... Clauses>
+auto append_sql_string(Context& context,
+                       std::string& out,
+                       const statement_t<Clauses...>& t) -> void {
+  check_compatibility<Context>(t).verify();
+  (append_sql_string(context, out, static_cast<const Clauses&>(t)), ...);
+}
+
 template <typename Context, typename... Clauses>
 auto to_sql_string(Context& context, const statement_t<Clauses...>& t)
     -> std::string {
-  check_compatibility<Context>(t).verify();
   auto result = std::string{};
-  ((result += to_sql_string(context, static_cast<const Clauses&>(t))), ...);
-
+  append_sql_string(context, result, t);
   return result;
 }
 
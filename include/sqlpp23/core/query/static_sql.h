@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+// Statements with static SQL (see `has_static_sql`) serialize to the same
+// string every time. The string is therefore computed once per context type
+// and statement type and kept for the lifetime of the program.
+//
+// Note: The context is not modified by subsequent calls, e.g. parameters are
+// not counted again.
+template <typename Context, typename Statement>
+  requires(has_static_sql<Statement>::value)
+auto static_sql_string(Context& context, const Statement& t)
+    -> const std::string& {
+  static const auto sql = to_sql_string(context, t);
+  return sql;
+}
+
+// Returns the static SQL of the statement, if available. Otherwise the
+// statement is serialized into the buffer, which is then returned.
+template <typename Context, typename Statement>
+auto statement_sql_string(Context& context,
+                          const Statement& t,
+                          std::string& buffer) -> const std::string& {
+  if constexpr (has_static_sql<Statement>::value) {
+    return static_sql_string(context, t);
+  } else {
+    append_sql_string(context, buffer, t);
+    return buffer;
+  }
+}
+
+}  // namespace sqlpp
@@ -27,8 +27,16 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstdint>
 #include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace sqlpp {
 namespace detail {
@@ -51,6 +59,30 @@ struct result_size_type<
     std::void_t<decltype(std::declval<DbResult>().size())>> {
   using type = decltype(std::declval<DbResult>().size());
 };
+
+// Result fields of text and blob refer to the connector's buffers, which are
+// only valid until the next row is fetched.
+template <typename T>
+T to_owning(const T& value) {
+  return value;
+}
+
+inline std::string to_owning(std::string_view value) {
+  return std::string(value);
+}
+
+inline std::vector<uint8_t> to_owning(std::span<const uint8_t> value) {
+  return std::vector<uint8_t>(value.begin(), value.end());
+}
+
+template <typename T>
+auto to_owning(const std::optional<T>& value)
+    -> std::optional<decltype(to_owning(*value))> {
+  if (not value.has_value()) {
+    return std::nullopt;
+  }
+  return to_owning(*value);
+}
 }  // namespace detail
 
 template <typename DbResult, typename ResultRow>
@@ -140,5 +172,37 @@ class result_t {
                   "Underlying connector does not support size()");
     return _result.size();
   }
+
+  // Reads the remaining rows into a vector, see read_into.
+  template <typename T>
+  std::vector<T> into() {
+    std::vector<T> target;
+    read_into(*this, target);
+    return target;
+  }
 };
+
+// Appends the remaining rows to `target`. Each element is constructed from
+// the fields of a row in the order of the selected columns, e.g. an aggregate
+// with matching members. Text and blob fields are copied from the connector's
+// buffers into std::string and std::vector<uint8_t> (or their optionals).
+template <typename T, typename DbResult, typename ResultRow>
+void read_into(result_t<DbResult, ResultRow>& result, std::vector<T>& target) {
+  if constexpr (detail::result_has_size<DbResult>::value) {
+    // size() counts all rows of the result, including rows that have already
+    // been consumed, so this is an upper bound.
+    target.reserve(target.size() + static_cast<size_t>(result.size()));
+  }
+  for (; not result.empty(); result.pop_front()) {
+    std::apply(
+        [&target](const auto&... fields) {
+          static_assert(
+              std::is_constructible_v<T, decltype(detail::to_owning(fields))...>,
+              "read_into: target type must be constructible from the "
+              "selected columns (in order)");
+          target.emplace_back(detail::to_owning(fields)...);
+        },
+        as_tuple(result.front()));
+  }
+}
 }  // namespace sqlpp
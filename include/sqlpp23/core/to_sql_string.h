@@ -29,7 +29,6 @@
 
 #include <array>
 #include <cmath>
-#include <format>
 #include <optional>
 #include <span>
 #include <string>
@@ -37,6 +36,7 @@
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/database/exception.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/type_traits.h>
 
 namespace sqlpp {
@@ -48,47 +48,47 @@ auto to_sql_string(Context&, ...) -> std::string {
 
 template <typename Context>
 auto to_sql_string(Context&, const bool& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const int8_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const int16_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const int32_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const int64_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const uint8_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const uint16_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const uint32_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const uint64_t& t) -> std::string {
-  return std::to_string(t);
+  return detail::number_to_string(t);
 }
 
 template <typename Context>
@@ -117,7 +117,7 @@ auto float_to_sql_string(Context& context, const T& f) -> std::string {
     return f > std::numeric_limits<T>::max() ? inf_to_sql_string(context)
                                              : neg_inf_to_sql_string(context);
   } else {
-    return std::format("{:.{}g}", f, std::numeric_limits<T>::digits10);
+    return detail::number_to_string(f);
   }
 }
 
@@ -195,13 +195,19 @@ auto to_sql_string(Context& context, const std::array<uint8_t, N>& t)
 template <typename Context>
 auto to_sql_string(Context&, const std::chrono::sys_days& t)
     -> std::string {
-  return std::format("DATE '{0:%Y-%m-%d}'", t);
+  auto result = std::string{"DATE '"};
+  detail::append_date(result, t);
+  result.push_back('\'');
+  return result;
 }
 
 template <typename Context>
 auto to_sql_string(Context&, const std::chrono::microseconds& t)
     -> std::string {
-  return std::format("'{0:%H:%M:%S}'", t);
+  auto result = std::string{"'"};
+  detail::append_time_of_day(result, t);
+  result.push_back('\'');
+  return result;
 }
 
 template <typename Period, typename Context>
@@ -209,7 +215,10 @@ auto to_sql_string(
     Context&,
     const std::chrono::time_point<std::chrono::system_clock, Period>& t)
     -> std::string {
-  return std::format("TIMESTAMP '{0:%Y-%m-%dT%H:%M:%S}'", t);
+  auto result = std::string{"TIMESTAMP '"};
+  detail::append_timestamp(result, t, 'T');
+  result.push_back('\'');
+  return result;
 }
 
 template <typename Context>
@@ -225,12 +234,34 @@ auto to_sql_string(Context& context, const std::optional<T>& t) -> std::string {
   return to_sql_string(context, *t);
 }
 
+// Serializers of composite nodes (clauses, operators, functions, ...) append
+// to a single buffer via `append_sql_string` instead of returning (and
+// concatenating) one string per node. They also provide `to_sql_string` for
+// direct use. Everything else, e.g. values and names (which mostly fit into the
+// small string buffer), is appended via `to_sql_string`.
+template <typename Context, typename T>
+auto append_sql_string(Context& context, std::string& out, const T& t) -> void {
+  out += to_sql_string(context, t);
+}
+
 template <typename T, typename Context>
-auto operand_to_sql_string(Context& context, const T& t) -> std::string {
+auto append_operand_sql_string(Context& context,
+                               std::string& out,
+                               const T& t) -> void {
   if (requires_parentheses<T>::value) {
-    return "(" + to_sql_string(context, t) + ")";
+    out += '(';
+    append_sql_string(context, out, t);
+    out += ')';
+    return;
   }
-  return to_sql_string(context, t);
+  append_sql_string(context, out, t);
+}
+
+template <typename T, typename Context>
+auto operand_to_sql_string(Context& context, const T& t) -> std::string {
+  auto result = std::string{};
+  append_operand_sql_string(context, result, t);
+  return result;
 }
 
 template <typename Context>
@@ -248,6 +279,17 @@ auto name_to_sql_string(Context& context, const NameTag&) -> std::string {
   }
 }
 
+template <typename NameTag, typename Context>
+auto append_name_sql_string(Context& context,
+                            std::string& out,
+                            const NameTag&) -> void {
+  if (NameTag::require_quotes) {
+    out += quoted_name_to_sql_string(context, NameTag::name);
+  } else {
+    out += NameTag::name;
+  }
+}
+
 template<typename Context>
 std::string data_type_to_sql_string(Context&, const boolean&) {
   return "BOOLEAN";
@@ -294,16 +336,19 @@ std::string data_type_to_sql_string(Context&, const date&) {
 }
 
 template <typename Context, typename Data>
-auto dynamic_clause_to_sql_string(Context& context,
-                                  std::string_view name,
-                                  const Data& data) -> std::string {
+auto append_dynamic_clause_sql_string(Context& context,
+                                      std::string& out,
+                                      std::string_view name,
+                                      const Data& data) -> void {
   if constexpr (is_dynamic<Data>::value) {
     if (data.has_value()) {
-      return std::format(" {} {}", name, to_sql_string(context, data.value()));
+      append_dynamic_clause_sql_string(context, out, name, data.value());
     }
-    return {};
   } else {
-    return std::format(" {} {}", name, to_sql_string(context, data));
+    out += ' ';
+    out += name;
+    out += ' ';
+    append_sql_string(context, out, data);
   }
 }
 
@@ -27,6 +27,8 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -37,19 +39,25 @@
 namespace sqlpp {
 struct tuple_operand {
   template <typename Context, typename T>
-  auto operator()(Context& context, const T& t, size_t index) const
-      -> std::string {
-    const auto prefix = index ? std::string{separator} : std::string{};
-    return prefix + operand_to_sql_string(context, t);
+  auto operator()(Context& context,
+                  std::string& out,
+                  const T& t,
+                  size_t index) const -> void {
+    if (index) {
+      out += separator;
+    }
+    append_operand_sql_string(context, out, t);
   }
 
   template <typename Context, typename T>
-  auto operator()(Context& context, const dynamic_t<T>& t, size_t index) const
-      -> std::string {
+  auto operator()(Context& context,
+                  std::string& out,
+                  const dynamic_t<T>& t,
+                  size_t index) const -> void {
     if (t.has_value()) {
-      return operator()(context, t.value(), index);
+      return operator()(context, out, t.value(), index);
     }
-    return operator()(context, std::nullopt, index);
+    return operator()(context, out, std::nullopt, index);
   }
 
   std::string_view separator;
@@ -58,20 +66,23 @@ struct tuple_operand {
 // Used to serialize tuple that should ignore dynamic elements.
 struct tuple_operand_no_dynamic {
   template <typename Context, typename T>
-  auto operator()(Context& context, const T& t, size_t) const -> std::string {
-    const auto prefix = need_prefix ? std::string{separator} : std::string{};
+  auto operator()(Context& context, std::string& out, const T& t, size_t) const
+      -> void {
+    if (need_prefix) {
+      out += separator;
+    }
     need_prefix = true;
-    return prefix + operand_to_sql_string(context, t);
+    append_operand_sql_string(context, out, t);
   }
 
   template <typename Context, typename T>
   auto operator()(Context& context,
+                  std::string& out,
                   const sqlpp::dynamic_t<T>& t,
-                  size_t index) const -> std::string {
+                  size_t index) const -> void {
     if (t.has_value()) {
-      return operator()(context, t.value(), index);
+      operator()(context, out, t.value(), index);
     }
-    return "";
   }
 
   std::string_view separator;
@@ -82,34 +93,41 @@ struct tuple_operand_no_dynamic {
 // In particular, it serializes unselected dynamic columns as "NULL AS <name>".
 struct tuple_operand_select_column {
   template <typename Context, typename T>
-  auto operator()(Context& context, const T& t, size_t index) const
-      -> std::string {
-    const auto prefix = index ? std::string{separator} : std::string{};
-    return prefix + operand_to_sql_string(context, t);
+  auto operator()(Context& context,
+                  std::string& out,
+                  const T& t,
+                  size_t index) const -> void {
+    if (index) {
+      out += separator;
+    }
+    append_operand_sql_string(context, out, t);
   }
 
   template <typename Context, typename T, typename NameTag>
   auto operator()(Context& context,
+                  std::string& out,
                   const sqlpp::dynamic_t<as_expression<T, NameTag>>& t,
-                  size_t index) const -> std::string {
+                  size_t index) const -> void {
     if (t.has_value()) {
-      return operator()(context, t.value(), index);
+      return operator()(context, out, t.value(), index);
     }
-    return operator()(
-        context, as_expression<std::nullopt_t, NameTag>{std::nullopt}, index);
+    return operator()(context, out,
+                      as_expression<std::nullopt_t, NameTag>{std::nullopt},
+                      index);
   }
 
   template <typename Context, typename T>
   auto operator()(Context& context,
+                  std::string& out,
                   const sqlpp::dynamic_t<T>& t,
-                  size_t index) const -> std::string {
+                  size_t index) const -> void {
     if (t.has_value()) {
-      return operator()(context, t.value(), index);
+      return operator()(context, out, t.value(), index);
     }
     static_assert(has_name_tag<T>::value, "select columns have to have a name");
     return operator()(
-        context, as_expression<std::nullopt_t, name_tag_of_t<T>>{std::nullopt},
-        index);
+        context, out,
+        as_expression<std::nullopt_t, name_tag_of_t<T>>{std::nullopt}, index);
   }
 
   std::string_view separator;
@@ -118,20 +136,23 @@ struct tuple_operand_select_column {
 // Used to names (ignoring dynamic)
 struct tuple_operand_name_no_dynamic {
   template <typename Context, typename T>
-  auto operator()(Context& context, const T&, size_t) const -> std::string {
-    const auto prefix = need_prefix ? std::string{separator} : std::string{};
+  auto operator()(Context& context, std::string& out, const T&, size_t) const
+      -> void {
+    if (need_prefix) {
+      out += separator;
+    }
     need_prefix = true;
-    return prefix + name_to_sql_string(context, name_tag_of_t<T>{});
+    append_name_sql_string(context, out, name_tag_of_t<T>{});
   }
 
   template <typename Context, typename T>
   auto operator()(Context& context,
+                  std::string& out,
                   const sqlpp::dynamic_t<T>& t,
-                  size_t index) const -> std::string {
+                  size_t index) const -> void {
     if (t.has_value()) {
-      return operator()(context, t.value(), index);
+      operator()(context, out, t.value(), index);
     }
-    return "";
   }
 
   std::string_view separator;
@@ -140,49 +161,67 @@ struct tuple_operand_name_no_dynamic {
 
 struct tuple_clause {
   template <typename Context, typename T>
-  auto operator()(Context& context, const T& t, size_t index) const
-      -> std::string {
-    const auto prefix = index ? std::string{separator} : std::string{};
-    return prefix + to_sql_string(context, t);
+  auto operator()(Context& context,
+                  std::string& out,
+                  const T& t,
+                  size_t index) const -> void {
+    if (index) {
+      out += separator;
+    }
+    append_sql_string(context, out, t);
   }
 
   std::string_view separator;
 };
 
 template <typename Context, typename Tuple, typename Strategy, size_t... Is>
-auto tuple_to_sql_string_impl(Context& context,
-                              const Tuple& t,
-                              const Strategy& strategy,
-                              const std::index_sequence<Is...>&
-                              /*unused*/) -> std::string {
+auto append_tuple_sql_string_impl(Context& context,
+                                  std::string& out,
+                                  const Tuple& t,
+                                  const Strategy& strategy,
+                                  const std::index_sequence<Is...>&
+                                  /*unused*/) -> void {
   // See https://en.cppreference.com/w/cpp/language/eval_order
-  auto result = std::string{};
-  ((result += strategy(context, std::get<Is>(t), Is)), ...);
-  return result;
+  (strategy(context, out, std::get<Is>(t), Is), ...);
+}
+
+template <typename Context, typename Tuple, typename Strategy>
+auto append_tuple_sql_string(Context& context,
+                             std::string& out,
+                             const Tuple& t,
+                             const Strategy& strategy) -> void {
+  append_tuple_sql_string_impl(
+      context, out, t, strategy,
+      std::make_index_sequence<std::tuple_size<Tuple>::value>{});
 }
 
 template <typename Context, typename Tuple, typename Strategy>
 auto tuple_to_sql_string(Context& context,
                          const Tuple& t,
                          const Strategy& strategy) -> std::string {
-  return tuple_to_sql_string_impl(
-      context, t, strategy,
-      std::make_index_sequence<std::tuple_size<Tuple>::value>{});
+  auto result = std::string{};
+  append_tuple_sql_string(context, result, t, strategy);
+  return result;
 }
 
 template <typename Context, typename... Expressions>
-auto dynamic_tuple_clause_to_sql_string(Context& context,
-                                        std::string_view name,
-                                        const std::tuple<Expressions...>& data)
-    -> std::string {
-  const auto expressions =
-      tuple_to_sql_string(context, data, tuple_operand_no_dynamic{", "});
-
-  if (expressions.empty()) {
-    return "";
+auto append_dynamic_tuple_clause_sql_string(
+    Context& context,
+    std::string& out,
+    std::string_view name,
+    const std::tuple<Expressions...>& data) -> void {
+  // Write the clause name optimistically and drop it again if all expressions
+  // are inactive.
+  const auto size = out.size();
+  out += ' ';
+  out += name;
+  out += ' ';
+  const auto expressions_start = out.size();
+  append_tuple_sql_string(context, out, data, tuple_operand_no_dynamic{", "});
+
+  if (out.size() == expressions_start) {
+    out.resize(size);
   }
-
-  return std::format(" {} {}", name, expressions);
 }
 
 }  // namespace sqlpp
@@ -45,6 +45,7 @@
 #include <sqlpp23/core/type_traits/ctes_of.h>
 #include <sqlpp23/core/type_traits/nodes_of.h>
 #include <sqlpp23/core/type_traits/optional.h>
+#include <sqlpp23/core/type_traits/static_sql.h>
 #include <sqlpp23/core/type_traits/tables_of.h>
 #include <sqlpp23/core/type_traits/data_type.h>
 #include <sqlpp23/core/wrapped_static_assert.h>
@@ -0,0 +1,69 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <optional>
+#include <type_traits>
+
+#include <sqlpp23/core/detail/type_vector.h>
+#include <sqlpp23/core/logic.h>
+#include <sqlpp23/core/noop_fwd.h>
+#include <sqlpp23/core/type_traits/nodes_of.h>
+
+namespace sqlpp {
+// Checks if the SQL representation of T is fully determined by its type, i.e.
+// T does not carry values, flags, or strings that are only known at runtime.
+// Statements with static SQL are serialized only once per context type, see
+// `static_sql_string`.
+//
+// Static SQL is opt-in: Columns, tables, parameters, keywords and the core
+// clauses and operators built from them specialize this trait. Everything else,
+// including custom expressions, is serialized for each call unless it opts in,
+// too.
+template <typename T>
+struct has_static_sql : public std::false_type {};
+
+template <typename... T>
+struct has_static_sql<detail::type_vector<T...>>
+    : public std::integral_constant<
+          bool,
+          logic::all<has_static_sql<T>::value...>::value> {};
+
+// Helper for opting in nodes that serialize nothing but keywords and their
+// nodes (see `nodes_of`).
+template <typename T>
+struct has_static_sql_nodes : public has_static_sql<nodes_of_t<T>> {};
+
+template <>
+struct has_static_sql<noop> : public std::true_type {};
+
+template <>
+struct has_static_sql<std::nullopt_t> : public std::true_type {};
+
+}  // namespace sqlpp
@@ -29,6 +29,8 @@
 
 #include <sqlpp23/core/wrong.h>
 #include <sqlpp23/core/consistent.h>
+#include <sqlpp23/core/detail/type_set.h>
+#include <array>
 #include <type_traits>
 
 namespace sqlpp {
@@ -69,22 +71,23 @@ using static_check_t =
     typename detail::static_check_impl<Consistent, Assert>::type;
 
 namespace detail {
-template <typename... StaticChecks>
-struct static_combined_check_impl;
-
-template <typename StaticCheck, typename... Rest>
-struct static_combined_check_impl<StaticCheck, Rest...> {
-  using type = StaticCheck;
-};
-
-template <typename... Rest>
-struct static_combined_check_impl<consistent_t, Rest...> {
-  using type = typename static_combined_check_impl<Rest...>::type;
-};
+template <size_t N>
+constexpr size_t first_inconsistent_index(
+    const std::array<bool, N>& consistent) {
+  for (size_t i = 0; i < N; ++i) {
+    if (not consistent[i]) {
+      return i;
+    }
+  }
+  return N;
+}
 
-template <>
-struct static_combined_check_impl<> {
-  using type = consistent_t;
+// Yields the first check that is not consistent_t (or consistent_t).
+template <typename... StaticChecks>
+struct static_combined_check_impl {
+  using type = typename _type_list<StaticChecks..., consistent_t>::template at<
+      first_inconsistent_index<sizeof...(StaticChecks)>(
+          {std::is_same<StaticChecks, consistent_t>::value...})>;
 };
 }  // namespace detail
 
@@ -27,8 +27,10 @@
  */
 
 #include <cstddef>
+#include <vector>
 
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/database/parameter_list.h>
 #include <sqlpp23/core/debug_logger.h>
 #include <sqlpp23/mock_db/database/connection_config.h>
 
@@ -57,6 +59,10 @@ class prepared_statement_t {
   }
 
   const debug_logger& debug() { return _config->debug; }
+
+  // Positions of the parameters in the prepared statement (empty if all are
+  // in list order), see sqlpp::active_parameters.
+  parameter_positions_t _active_parameters;
 };
 
 inline void bind_parameter(prepared_statement_t& statement,
@@ -27,7 +27,6 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <cstdlib>
 #include <optional>
 #include <span>
 #include <string_view>
@@ -36,6 +35,7 @@
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/mock_db/database/connection_config.h>
 
@@ -137,19 +137,19 @@ inline void read_field(const text_result_t& result, size_t index, bool& value) {
 inline void read_field(const text_result_t& result,
                        size_t index,
                        double& value) {
-  value = std::strtod(result.get_field(index).c_str(), nullptr);
+  ::sqlpp::detail::parse_number(result.get_field(index), value);
 }
 
 inline void read_field(const text_result_t& result,
                        size_t index,
                        int64_t& value) {
-  value = std::strtoll(result.get_field(index).c_str(), nullptr, 10);
+  ::sqlpp::detail::parse_number(result.get_field(index), value);
 }
 
 inline void read_field(const text_result_t& result,
                        size_t index,
                        uint64_t& value) {
-  value = std::strtoull(result.get_field(index).c_str(), nullptr, 10);
+  ::sqlpp::detail::parse_number(result.get_field(index), value);
 }
 inline void read_field(const text_result_t& result,
                        size_t index,
@@ -0,0 +1,172 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef SQLPP_USE_MARIADB
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <sqlpp23/core/debug_logger.h>
+#include <sqlpp23/mysql/database/connection_config.h>
+#include <sqlpp23/mysql/database/exception.h>
+#include <sqlpp23/mysql/sqlpp_mysql.h>
+#include <sqlpp23/mysql/text_result.h>
+
+namespace sqlpp::mysql {
+// A statement executed via the non-blocking API of MariaDB Connector/C, see
+// https://mariadb.com/kb/en/non-blocking-client-library/
+//
+// The statement is started upon construction. While it is not `done()`, the
+// caller waits for the events in `wait_status()` (MYSQL_WAIT_READ,
+// MYSQL_WAIT_WRITE, MYSQL_WAIT_EXCEPT) on `socket()`, or for `timeout_ms()` if
+// MYSQL_WAIT_TIMEOUT is set, and then calls `resume()` with the events that
+// occurred. This way, a single thread can drive queries on many connections,
+// e.g. using poll, epoll, or an event loop like asio.
+//
+// The connection must not be used otherwise until the query is done.
+class async_query_t {
+  enum class phase { query, store_result, done };
+
+  MYSQL* _mysql;
+  const connection_config* _config;
+  // The client library might refer to the statement while the query is
+  // suspended, so its address must not change when this object is moved.
+  std::unique_ptr<const std::string> _statement;
+  phase _phase = phase::query;
+  int _wait_status = 0;
+  uint64_t _affected_rows = 0;
+  std::unique_ptr<MYSQL_RES, void (*)(MYSQL_RES*)> _result{nullptr,
+                                                           mysql_free_result};
+
+ public:
+  async_query_t(MYSQL* mysql,
+                std::string statement,
+                const connection_config* config)
+      : _mysql{mysql},
+        _config{config},
+        _statement{std::make_unique<const std::string>(std::move(statement))} {
+    if constexpr (debug_enabled) {
+      _config->debug.log(log_category::statement, "Starting async: '{}'",
+                         *_statement);
+    }
+    int error = 0;
+    _wait_status = mysql_real_query_start(&error, _mysql, _statement->data(),
+                                          _statement->size());
+    _on_query(error);
+  }
+
+  async_query_t(const async_query_t&) = delete;
+  async_query_t(async_query_t&&) = default;
+  async_query_t& operator=(const async_query_t&) = delete;
+  async_query_t& operator=(async_query_t&&) = default;
+  ~async_query_t() = default;
+
+  bool done() const { return _phase == phase::done; }
+
+  // Events to wait for before calling resume (0 if done).
+  int wait_status() const { return _wait_status; }
+
+  my_socket socket() const { return mysql_get_socket(_mysql); }
+
+  unsigned int timeout_ms() const { return mysql_get_timeout_value_ms(_mysql); }
+
+  // Continues the query after (some of) the events in `wait_status()`
+  // occurred. Returns true if the query is done. Throws if the query failed.
+  bool resume(int ready_status) {
+    switch (_phase) {
+      case phase::query: {
+        int error = 0;
+        _wait_status = mysql_real_query_cont(&error, _mysql, ready_status);
+        _on_query(error);
+        break;
+      }
+      case phase::store_result: {
+        MYSQL_RES* result = nullptr;
+        _wait_status = mysql_store_result_cont(&result, _mysql, ready_status);
+        _on_store_result(result);
+        break;
+      }
+      case phase::done:
+        throw sqlpp::exception{"MySQL: async query is already done"};
+    }
+    return done();
+  }
+
+  // Number of affected rows of a statement without result set.
+  uint64_t affected_rows() const { return _affected_rows; }
+
+  bool has_result() const { return _result != nullptr; }
+
+  // Takes the result set of a done statement (e.g. a select). The result has
+  // been transferred completely, iterating over it does not block.
+  text_result_t result() {
+    if (not done() or not has_result()) {
+      throw sqlpp::exception{"MySQL: async query has no result (yet)"};
+    }
+    return {std::move(_result), _config};
+  }
+
+ private:
+  void _on_query(int error) {
+    if (_wait_status != 0) {
+      return;
+    }
+    if (error) {
+      _phase = phase::done;
+      throw exception{mysql_error(_mysql), mysql_errno(_mysql)};
+    }
+    if (mysql_field_count(_mysql) == 0) {
+      _affected_rows = mysql_affected_rows(_mysql);
+      _phase = phase::done;
+      return;
+    }
+
+    _phase = phase::store_result;
+    MYSQL_RES* result = nullptr;
+    _wait_status = mysql_store_result_start(&result, _mysql);
+    _on_store_result(result);
+  }
+
+  void _on_store_result(MYSQL_RES* result) {
+    if (_wait_status != 0) {
+      return;
+    }
+    _phase = phase::done;
+    if (not result) {
+      throw exception{mysql_error(_mysql), mysql_errno(_mysql)};
+    }
+    _result.reset(result);
+  }
+};
+}  // namespace sqlpp::mysql
+
+#endif
@@ -0,0 +1,400 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/database/parameter_list.h>
+#include <sqlpp23/core/database/prepared_delete.h>
+#include <sqlpp23/core/database/prepared_insert.h>
+#include <sqlpp23/core/database/prepared_update.h>
+#include <sqlpp23/core/type_traits/optional.h>
+#include <sqlpp23/core/wrong.h>
+#include <sqlpp23/mysql/prepared_statement.h>
+#include <sqlpp23/mysql/sqlpp_mysql.h>
+
+namespace sqlpp::mysql::detail {
+
+// Column-wise storage of parameter values for bulk execution.
+//
+// Fixed-size values are stored in contiguous arrays, text and blob values are
+// copied into a shared byte buffer. This allows to bind all rows at once
+// (array binding) or one row at a time.
+struct bulk_column {
+  enum_field_types buffer_type = MYSQL_TYPE_NULL;
+  bool is_unsigned = false;
+  std::vector<wrapped_bool> is_null;
+  std::vector<unsigned long> lengths;
+  std::vector<int64_t> integers;
+  std::vector<uint64_t> unsigned_integers;
+  std::vector<double> doubles;
+  std::vector<MYSQL_TIME> times;
+  std::vector<char> bytes;
+  std::vector<size_t> offsets;
+  std::vector<char*> pointers;
+
+  bool has_variable_length() const {
+    return buffer_type == MYSQL_TYPE_STRING or buffer_type == MYSQL_TYPE_BLOB;
+  }
+
+  void clear() {
+    is_null.clear();
+    lengths.clear();
+    integers.clear();
+    unsigned_integers.clear();
+    doubles.clear();
+    times.clear();
+    bytes.clear();
+    offsets.clear();
+    pointers.clear();
+  }
+
+  // Text and blob data can only be referenced once all rows have been added,
+  // since the byte buffer might be reallocated while rows are added.
+  void finalize() {
+    if (has_variable_length()) {
+      pointers.resize(offsets.size());
+      for (size_t row = 0; row < offsets.size(); ++row) {
+        pointers[row] = bytes.data() + offsets[row];
+      }
+    }
+  }
+
+  // Pointer to the whole column, as required for array binding.
+  void* array_buffer() {
+    switch (buffer_type) {
+      case MYSQL_TYPE_STRING:
+      case MYSQL_TYPE_BLOB:
+        return pointers.data();
+      case MYSQL_TYPE_DOUBLE:
+        return doubles.data();
+      case MYSQL_TYPE_DATE:
+      case MYSQL_TYPE_DATETIME:
+      case MYSQL_TYPE_TIME:
+        return times.data();
+      default:
+        return is_unsigned ? static_cast<void*>(unsigned_integers.data())
+                           : static_cast<void*>(integers.data());
+    }
+  }
+
+  // Pointer to the value of a single row.
+  void* row_buffer(size_t row) {
+    switch (buffer_type) {
+      case MYSQL_TYPE_STRING:
+      case MYSQL_TYPE_BLOB:
+        return pointers[row];
+      case MYSQL_TYPE_DOUBLE:
+        return &doubles[row];
+      case MYSQL_TYPE_DATE:
+      case MYSQL_TYPE_DATETIME:
+      case MYSQL_TYPE_TIME:
+        return &times[row];
+      default:
+        return is_unsigned ? static_cast<void*>(&unsigned_integers[row])
+                           : static_cast<void*>(&integers[row]);
+    }
+  }
+
+  void append_null() {
+    is_null.emplace_back(true);
+    lengths.push_back(0);
+    switch (buffer_type) {
+      case MYSQL_TYPE_STRING:
+      case MYSQL_TYPE_BLOB:
+        offsets.push_back(bytes.size());
+        break;
+      case MYSQL_TYPE_DOUBLE:
+        doubles.push_back(0.0);
+        break;
+      case MYSQL_TYPE_DATE:
+      case MYSQL_TYPE_DATETIME:
+      case MYSQL_TYPE_TIME:
+        times.push_back(MYSQL_TIME{});
+        break;
+      default:
+        if (is_unsigned) {
+          unsigned_integers.push_back(0);
+        } else {
+          integers.push_back(0);
+        }
+    }
+  }
+
+  void append_bytes(const char* data, size_t size) {
+    is_null.emplace_back(false);
+    lengths.push_back(static_cast<unsigned long>(size));
+    offsets.push_back(bytes.size());
+    bytes.insert(bytes.end(), data, data + size);
+  }
+};
+
+template <typename Value>
+void init_bulk_column(bulk_column& column) {
+  if constexpr (is_optional<Value>::value) {
+    init_bulk_column<typename Value::value_type>(column);
+  } else if constexpr (std::is_same_v<Value, bool> or
+                       std::is_same_v<Value, int64_t>) {
+    column.buffer_type = MYSQL_TYPE_LONGLONG;
+  } else if constexpr (std::is_same_v<Value, uint64_t>) {
+    column.buffer_type = MYSQL_TYPE_LONGLONG;
+    column.is_unsigned = true;
+  } else if constexpr (std::is_same_v<Value, double>) {
+    column.buffer_type = MYSQL_TYPE_DOUBLE;
+  } else if constexpr (std::is_same_v<Value, std::string>) {
+    column.buffer_type = MYSQL_TYPE_STRING;
+  } else if constexpr (std::is_same_v<Value, std::vector<uint8_t>>) {
+    column.buffer_type = MYSQL_TYPE_BLOB;
+  } else if constexpr (std::is_same_v<Value, std::chrono::sys_days>) {
+    column.buffer_type = MYSQL_TYPE_DATE;
+  } else if constexpr (std::is_same_v<Value,
+                                      ::sqlpp::chrono::sys_microseconds>) {
+    column.buffer_type = MYSQL_TYPE_DATETIME;
+  } else if constexpr (std::is_same_v<Value, std::chrono::microseconds>) {
+    column.buffer_type = MYSQL_TYPE_TIME;
+  } else {
+    static_assert(wrong_t<Value>::value,
+                  "MySQL: unsupported parameter type for bulk execution");
+  }
+}
+
+// Appends `arg` to `column`, converting it to the parameter's value type.
+template <typename Value, typename Arg>
+void append_bulk_value(bulk_column& column, const Arg& arg) {
+  if constexpr (is_optional<Value>::value) {
+    if constexpr (std::is_same_v<Arg, std::nullopt_t>) {
+      column.append_null();
+    } else if constexpr (is_optional<Arg>::value) {
+      if (arg.has_value()) {
+        append_bulk_value<typename Value::value_type>(column, *arg);
+      } else {
+        column.append_null();
+      }
+    } else {
+      append_bulk_value<typename Value::value_type>(column, arg);
+    }
+  } else if constexpr (std::is_same_v<Value, std::string>) {
+    const auto text = std::string_view{arg};
+    column.append_bytes(text.data(), text.size());
+  } else if constexpr (std::is_same_v<Value, std::vector<uint8_t>>) {
+    const auto data = std::span<const uint8_t>{arg};
+    column.append_bytes(reinterpret_cast<const char*>(data.data()),
+                        data.size());
+  } else {
+    column.is_null.emplace_back(false);
+    if constexpr (std::is_same_v<Value, bool>) {
+      column.lengths.push_back(sizeof(int64_t));
+      column.integers.push_back(arg ? 1 : 0);
+    } else if constexpr (std::is_same_v<Value, int64_t>) {
+      column.lengths.push_back(sizeof(int64_t));
+      column.integers.push_back(static_cast<int64_t>(arg));
+    } else if constexpr (std::is_same_v<Value, uint64_t>) {
+      column.lengths.push_back(sizeof(uint64_t));
+      column.unsigned_integers.push_back(static_cast<uint64_t>(arg));
+    } else if constexpr (std::is_same_v<Value, double>) {
+      column.lengths.push_back(sizeof(double));
+      column.doubles.push_back(static_cast<double>(arg));
+    } else {
+      column.lengths.push_back(sizeof(MYSQL_TIME));
+      column.times.push_back(to_mysql_time(Value{arg}));
+    }
+  }
+}
+
+// Collects rows of parameter values for bulk execution of a prepared
+// statement. `Values` are the value types of the statement's parameters.
+//
+// Columns are stored in parameter list order. They are bound at the positions
+// of the parameters in the prepared statement, see `active_parameters`.
+// Values of inactive parameters (in dynamic parts that were not serialized)
+// are collected, but not bound.
+template <typename... Values>
+class bulk_parameters {
+  std::vector<bulk_column> _columns;
+  parameter_positions_t _positions;
+  std::vector<MYSQL_BIND> _binds;
+#ifdef SQLPP_USE_MARIADB
+  std::vector<std::vector<char>> _indicators;
+#endif
+  size_t _rows = 0;
+
+ public:
+  explicit bulk_parameters(parameter_positions_t positions)
+      : _columns(sizeof...(Values)),  // ()-init for correct constructor
+        _positions(std::move(positions)),
+        _binds(_active_count(),
+               MYSQL_BIND{}) {  // ()-init for correct constructor
+    _init_columns(std::index_sequence_for<Values...>{});
+  }
+
+  size_t size() const { return _rows; }
+
+  void clear() {
+    for (auto& column : _columns) {
+      column.clear();
+    }
+    _rows = 0;
+  }
+
+  template <typename Row>
+  void add_row(const Row& row) {
+    static_assert(std::tuple_size_v<Row> == sizeof...(Values),
+                  "MySQL: number of values in row does not match the number "
+                  "of parameters of the prepared statement");
+    _add_row(row, std::index_sequence_for<Values...>{});
+    ++_rows;
+  }
+
+  // Has to be called after the last row was added and before binding.
+  void finalize() {
+    for (auto& column : _columns) {
+      column.finalize();
+    }
+  }
+
+  // Binds the values of a single row, e.g. for mysql_stmt_bind_param.
+  MYSQL_BIND* bind_row(size_t row) {
+    for (size_t index = 0; index < _columns.size(); ++index) {
+      const auto position = _position(index);
+      if (not position.has_value()) {
+        continue;
+      }
+      auto& column = _columns[index];
+      MYSQL_BIND& param{_binds[*position]};
+      param = MYSQL_BIND{};
+      param.buffer_type = column.buffer_type;
+      param.buffer = column.row_buffer(row);
+      param.buffer_length = column.lengths[row];
+      param.length = &column.lengths[row];
+      param.is_null = &column.is_null[row].value;
+      param.is_unsigned = column.is_unsigned;
+    }
+    return _binds.data();
+  }
+
+#ifdef SQLPP_USE_MARIADB
+  // Binds all rows at once, see
+  // https://mariadb.com/kb/en/bulk-insert-column-wise-binding/
+  MYSQL_BIND* bind_array() {
+    _indicators.resize(_columns.size());
+    for (size_t index = 0; index < _columns.size(); ++index) {
+      const auto position = _position(index);
+      if (not position.has_value()) {
+        continue;
+      }
+      auto& column = _columns[index];
+      auto& indicators = _indicators[index];
+      indicators.resize(_rows);
+      for (size_t row = 0; row < _rows; ++row) {
+        indicators[row] = column.is_null[row].value ? STMT_INDICATOR_NULL
+                                                    : STMT_INDICATOR_NONE;
+      }
+      MYSQL_BIND& param{_binds[*position]};
+      param = MYSQL_BIND{};
+      param.buffer_type = column.buffer_type;
+      param.buffer = column.array_buffer();
+      param.length = column.lengths.data();
+      param.u.indicator = indicators.data();
+      param.is_unsigned = column.is_unsigned;
+    }
+    return _binds.data();
+  }
+#endif
+
+ private:
+  // Empty positions mean that all parameters are bound in list order.
+  std::optional<size_t> _position(size_t index) const {
+    if (_positions.empty()) {
+      return index;
+    }
+    return _positions[index];
+  }
+
+  size_t _active_count() const {
+    if (_positions.empty()) {
+      return sizeof...(Values);
+    }
+    return static_cast<size_t>(
+        std::ranges::count_if(_positions, [](const auto& position) {
+          return position.has_value();
+        }));
+  }
+
+  template <size_t... Is>
+  void _init_columns(std::index_sequence<Is...>) {
+    (init_bulk_column<Values>(_columns[Is]), ...);
+  }
+
+  template <typename Row, size_t... Is>
+  void _add_row(const Row& row, std::index_sequence<Is...>) {
+    using std::get;
+    (append_bulk_value<Values>(_columns[Is], get<Is>(row)), ...);
+  }
+};
+
+template <typename MemberTuple>
+struct bulk_parameters_for;
+
+template <typename... Members>
+struct bulk_parameters_for<std::tuple<Members...>> {
+  using type = bulk_parameters<
+      std::remove_cvref_t<decltype(std::declval<Members&>()())>...>;
+};
+
+template <typename PreparedStatement>
+struct is_bulk_executable : public std::false_type {};
+
+template <typename Db, typename Statement>
+struct is_bulk_executable<prepared_insert_t<Db, Statement>>
+    : public std::true_type {};
+
+template <typename Db, typename Statement>
+struct is_bulk_executable<prepared_update_t<Db, Statement>>
+    : public std::true_type {};
+
+template <typename Db, typename Statement>
+struct is_bulk_executable<prepared_delete_t<Db, Statement>>
+    : public std::true_type {};
+
+// Bulk parameters for the parameter list of a prepared statement.
+template <typename ParameterList>
+using bulk_parameters_for_t =
+    typename bulk_parameters_for<typename ParameterList::_member_tuple_t>::type;
+
+}  // namespace sqlpp::mysql::detail
@@ -28,15 +28,23 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <exception>
+#include <format>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/database/parameter_list.h>
 #include <sqlpp23/core/query/statement.h>
+#include <sqlpp23/core/query/static_sql.h>
 #include <sqlpp23/core/query/statement_handler.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/mysql/async_query.h>
 #include <sqlpp23/mysql/bind_result.h>
+#include <sqlpp23/mysql/bulk_parameters.h>
 #include <sqlpp23/mysql/clause/delete_from.h>
 #include <sqlpp23/mysql/clause/update.h>
 #include <sqlpp23/mysql/constraints.h>
@@ -44,6 +52,7 @@
 #include <sqlpp23/mysql/database/connection_handle.h>
 #include <sqlpp23/mysql/database/exception.h>
 #include <sqlpp23/mysql/database/serializer_context.h>
+#include <sqlpp23/mysql/load_data.h>
 #include <sqlpp23/mysql/prepared_statement.h>
 #include <sqlpp23/mysql/sqlpp_mysql.h>
 #include <sqlpp23/mysql/text_result.h>
@@ -102,6 +111,69 @@ inline void execute_prepared_statement(
   }
 }
 
+inline void bind_and_execute(MYSQL_STMT* stmt, MYSQL_BIND* parameters) {
+  if (mysql_stmt_bind_param(stmt, parameters)) {
+    throw exception{mysql_stmt_error(stmt), mysql_stmt_errno(stmt)};
+  }
+
+  if (mysql_stmt_execute(stmt)) {
+    throw exception{mysql_stmt_error(stmt), mysql_stmt_errno(stmt)};
+  }
+}
+
+// Executes the prepared statement for all rows in `parameters` and returns the
+// total number of affected rows.
+template <typename BulkParameters>
+uint64_t execute_bulk(prepared_statement_t& prepared_statement,
+                      BulkParameters& parameters,
+                      bool use_array_binding) {
+  thread_init();
+
+  MYSQL_STMT* stmt = prepared_statement.native_handle().get();
+#ifdef SQLPP_USE_MARIADB
+  if (use_array_binding) {
+    if constexpr (debug_enabled) {
+      prepared_statement.debug().log(
+          log_category::statement,
+          "Executing prepared_statement with array binding for {} rows",
+          parameters.size());
+    }
+
+    unsigned int array_size = static_cast<unsigned int>(parameters.size());
+    if (mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, &array_size)) {
+      throw exception{mysql_stmt_error(stmt), mysql_stmt_errno(stmt)};
+    }
+    // The statement must not keep the array size for regular executions.
+    struct array_size_reset {
+      MYSQL_STMT* stmt;
+      ~array_size_reset() {
+        unsigned int no_array = 0;
+        mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, &no_array);
+      }
+    } reset{stmt};
+
+    bind_and_execute(stmt, parameters.bind_array());
+    return mysql_stmt_affected_rows(stmt);
+  }
+#else
+  (void)use_array_binding;
+#endif
+
+  if constexpr (debug_enabled) {
+    prepared_statement.debug().log(
+        log_category::statement,
+        "Executing prepared_statement row by row for {} rows",
+        parameters.size());
+  }
+
+  uint64_t affected_rows = 0;
+  for (size_t row = 0; row < parameters.size(); ++row) {
+    bind_and_execute(stmt, parameters.bind_row(row));
+    affected_rows += mysql_stmt_affected_rows(stmt);
+  }
+  return affected_rows;
+}
+
 }  // namespace detail
 
 struct scoped_library_initializer_t {
@@ -139,6 +211,8 @@ class connection_base : public sqlpp::connection {
   using _handle_t = detail::connection_handle;
 
   using _prepared_statement_t = ::sqlpp::mysql::prepared_statement_t;
+  using _context_t = context_t;
+  using _literals_t = std::vector<detail::literal_parameter>;
 
  private:
   friend sqlpp::statement_handler_t;
@@ -182,9 +256,51 @@ class connection_base : public sqlpp::connection {
     return {.affected_rows = mysql_affected_rows(_handle.native_handle())};
   }
 
+  std::vector<std::string> fetch_warnings() {
+    execute_statement(_handle, "SHOW WARNINGS");
+    std::unique_ptr<MYSQL_RES, void (*)(MYSQL_RES*)> result = {
+        mysql_store_result(_handle.native_handle()), mysql_free_result};
+    if (!result) {
+      throw exception{mysql_error(_handle.native_handle()),
+                      mysql_errno(_handle.native_handle())};
+    }
+
+    // Columns are Level, Code, and Message
+    std::vector<std::string> warnings;
+    while (MYSQL_ROW row = mysql_fetch_row(result.get())) {
+      warnings.push_back(std::format("{} {}: {}", row[0] ? row[0] : "",
+                                     row[1] ? row[1] : "",
+                                     row[2] ? row[2] : ""));
+    }
+    return warnings;
+  }
+
+  // Literals are replaced by parameters if enabled, see
+  // connection_config::auto_parameterize. Selects are not affected, as direct
+  // selects return text results while prepared selects return bind results.
+  void collect_literals(context_t& context,
+                        std::vector<detail::literal_parameter>& literals) {
+    if (_handle.config->auto_parameterize) {
+      _collect_literals(context, literals);
+    }
+  }
+
+  // Prepares the statement and binds the literals that were replaced by
+  // parameters during serialization.
+  prepared_statement_t prepare_literals_impl(
+      const std::string& statement,
+      const std::vector<detail::literal_parameter>& literals) {
+    auto prepared = prepare_impl(statement, literals.size(), {});
+    for (size_t i = 0; i < literals.size(); ++i) {
+      prepared.bind_literal(i, literals[i]);
+    }
+    return prepared;
+  }
+
   // prepared execution
   prepared_statement_t prepare_impl(const std::string& statement,
-                                    size_t no_of_parameters) {
+                                    size_t no_of_parameters,
+                                    parameter_positions_t active) {
     detail::thread_init();
 
     if constexpr (debug_enabled) {
@@ -192,8 +308,11 @@ class connection_base : public sqlpp::connection {
                           statement);
     }
 
-    return prepared_statement_t(_handle.native_handle(), statement,
-                                no_of_parameters, _handle.config.get());
+    auto prepared = prepared_statement_t(_handle.native_handle(), statement,
+                                         no_of_parameters,
+                                         _handle.config.get());
+    prepared._active_parameters = std::move(active);
+    return prepared;
   }
 
   bind_result_t run_prepared_select_impl(
@@ -231,15 +350,24 @@ class connection_base : public sqlpp::connection {
   template <typename Execute>
   command_result _execute(const Execute& i) {
     context_t context(this);
-    const auto query = to_sql_string(context, i);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, i, buffer);
+    if (not literals.empty()) {
+      auto prepared = prepare_literals_impl(query, literals);
+      return run_prepared_update_impl(prepared);
+    }
     return execute_impl(query);
   }
 
   template <typename Execute>
   _prepared_statement_t _prepare_execute(const Execute& u) {
     context_t context(this);
-    const auto query = to_sql_string(context, u);
-    return prepare_impl(query, parameters_of_t<std::decay_t<Execute>>::size());
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, u, buffer);
+    return prepare_impl(query, parameters_of_t<std::decay_t<Execute>>::size(),
+                        active_parameters<Execute>(context._parameters));
   }
 
   template <typename PreparedExecute>
@@ -252,15 +380,18 @@ class connection_base : public sqlpp::connection {
   template <typename Select>
   text_result_t _select(const Select& s) {
     context_t context(this);
-    const auto query = to_sql_string(context, s);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
     return select_impl(query);
   }
 
   template <typename Select>
   _prepared_statement_t _prepare_select(const Select& s) {
     context_t context(this);
-    const auto query = to_sql_string(context, s);
-    return prepare_impl(query, parameters_of_t<std::decay_t<Select>>::size());
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return prepare_impl(query, parameters_of_t<std::decay_t<Select>>::size(),
+                        active_parameters<Select>(context._parameters));
   }
 
   template <typename PreparedSelect>
@@ -275,15 +406,24 @@ class connection_base : public sqlpp::connection {
   template <typename Insert>
   insert_result _insert(const Insert& i) {
     context_t context(this);
-    const auto query = to_sql_string(context, i);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, i, buffer);
+    if (not literals.empty()) {
+      auto prepared = prepare_literals_impl(query, literals);
+      return run_prepared_insert_impl(prepared);
+    }
     return insert_impl(query);
   }
 
   template <typename Insert>
   _prepared_statement_t _prepare_insert(const Insert& i) {
     context_t context(this);
-    const auto query = to_sql_string(context, i);
-    return prepare_impl(query, parameters_of_t<std::decay_t<Insert>>::size());
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, i, buffer);
+    return prepare_impl(query, parameters_of_t<std::decay_t<Insert>>::size(),
+                        active_parameters<Insert>(context._parameters));
   }
 
   template <typename PreparedInsert>
@@ -297,15 +437,24 @@ class connection_base : public sqlpp::connection {
   template <typename Update>
   command_result _update(const Update& u) {
     context_t context(this);
-    const auto query = to_sql_string(context, u);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, u, buffer);
+    if (not literals.empty()) {
+      auto prepared = prepare_literals_impl(query, literals);
+      return run_prepared_update_impl(prepared);
+    }
     return update_impl(query);
   }
 
   template <typename Update>
   _prepared_statement_t _prepare_update(const Update& u) {
     context_t context(this);
-    const auto query = to_sql_string(context, u);
-    return prepare_impl(query, parameters_of_t<std::decay_t<Update>>::size());
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, u, buffer);
+    return prepare_impl(query, parameters_of_t<std::decay_t<Update>>::size(),
+                        active_parameters<Update>(context._parameters));
   }
 
   template <typename PreparedUpdate>
@@ -319,15 +468,24 @@ class connection_base : public sqlpp::connection {
   template <typename Delete>
   command_result _delete_from(const Delete& r) {
     context_t context(this);
-    const auto query = to_sql_string(context, r);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, r, buffer);
+    if (not literals.empty()) {
+      auto prepared = prepare_literals_impl(query, literals);
+      return run_prepared_delete_from_impl(prepared);
+    }
     return delete_from_impl(query);
   }
 
   template <typename Delete>
   _prepared_statement_t _prepare_delete_from(const Delete& r) {
     context_t context(this);
-    const auto query = to_sql_string(context, r);
-    return prepare_impl(query, parameters_of_t<std::decay_t<Delete>>::size());
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, r, buffer);
+    return prepare_impl(query, parameters_of_t<std::decay_t<Delete>>::size(),
+                        active_parameters<Delete>(context._parameters));
   }
 
   template <typename PreparedDelete>
@@ -372,6 +530,174 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! call prepare on the argument and apply the given options to the
+  //! resulting prepared statement, e.g. to use a server side cursor
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto prepare(const T& t, const prepare_options& options) {
+    auto prepared = prepare(t);
+    sqlpp::statement_handler_t{}.get_prepared_statement(prepared).set_options(
+        options);
+    return prepared;
+  }
+
+  //! execute a prepared insert, update or delete_from for each row in `rows`.
+  //! Each row is a tuple with one value per parameter, in the order in which
+  //! the parameters appear in the statement. Values of parameters in inactive
+  //! dynamic parts of the statement are ignored.
+  //! If the server supports it (MariaDB), rows are sent in chunks of up to
+  //! `max_rows_per_execute` rows using array binding, see
+  //! https://mariadb.com/kb/en/bulk-insert-column-wise-binding/
+  //! Otherwise the statement is executed once per row.
+  //! Returns the total number of affected rows.
+  template <typename PreparedStatement, typename Rows>
+    requires(detail::is_bulk_executable<PreparedStatement>::value)
+  command_result bulk_execute(PreparedStatement& p,
+                              const Rows& rows,
+                              size_t max_rows_per_execute = 1000) {
+    if (max_rows_per_execute == 0) {
+      throw sqlpp::exception{"MySQL: max_rows_per_execute must be at least 1"};
+    }
+    using _bulk_parameters_t = detail::bulk_parameters_for_t<
+        typename PreparedStatement::_parameter_list_t>;
+
+    auto& prepared_statement =
+        sqlpp::statement_handler_t{}.get_prepared_statement(p);
+    if (not prepared_statement._literals.empty()) {
+      throw sqlpp::exception{
+          "MySQL: bulk_execute does not support statements with literals "
+          "bound by cached"};
+    }
+    const bool use_array_binding = supports_array_binding();
+    auto parameters =
+        _bulk_parameters_t{prepared_statement._active_parameters};
+    auto result = command_result{.affected_rows = 0};
+    const auto flush = [&]() {
+      parameters.finalize();
+      result.affected_rows += detail::execute_bulk(
+          prepared_statement, parameters, use_array_binding);
+      parameters.clear();
+    };
+    for (const auto& row : rows) {
+      parameters.add_row(row);
+      if (parameters.size() == max_rows_per_execute) {
+        flush();
+      }
+    }
+    if (parameters.size() > 0) {
+      flush();
+    }
+    return result;
+  }
+
+  //! check if the server supports array binding for prepared statements
+  //! (requires MariaDB client and server)
+  bool supports_array_binding() {
+#ifdef SQLPP_USE_MARIADB
+    unsigned long capabilities = 0;
+    mariadb_get_infov(_handle.native_handle(),
+                      MARIADB_CONNECTION_EXTENDED_SERVER_CAPABILITIES,
+                      &capabilities);
+    return (capabilities & (MARIADB_CLIENT_STMT_BULK_OPERATIONS >> 32)) != 0;
+#else
+    return false;
+#endif
+  }
+
+#ifdef SQLPP_USE_MARIADB
+  //! start executing the argument using the non-blocking API of MariaDB, see
+  //! async_query_t for how to drive the query to completion.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  async_query_t start_async(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    context_t context(this);
+    return start_async(to_sql_string(context, t));
+  }
+
+  //! start executing an arbitrary statement using the non-blocking API of
+  //! MariaDB
+  async_query_t start_async(std::string statement) {
+    detail::thread_init();
+    _handle.enable_nonblocking();
+    return async_query_t{_handle.native_handle(), std::move(statement),
+                         _handle.config.get()};
+  }
+
+  //! take the result of a done async query, as returned by
+  //! `operator()(select)`
+  template <typename Select>
+    requires(sqlpp::is_statement_v<Select>)
+  auto async_result(async_query_t& query, const Select&)
+      -> decltype((*this)(std::declval<const Select&>())) {
+    return {query.result()};
+  }
+#endif
+
+  //! load rows into the given columns of a table using
+  //! LOAD DATA LOCAL INFILE, see
+  //! https://dev.mysql.com/doc/refman/8.0/en/load-data.html
+  //! The rows are streamed to the server as tab separated values, without
+  //! creating a file. Each row is a tuple with one value per column.
+  //! Requires `local_infile` to be set in the connection config (and to be
+  //! enabled on the server).
+  template <typename Table, typename... Columns, typename Rows>
+    requires(sqlpp::is_raw_table_v<Table> and
+             (sqlpp::is_column_v<Columns> and ...))
+  load_data_result load_data(const Table& table,
+                             const std::tuple<Columns...>& /*columns*/,
+                             const Rows& rows) {
+    static_assert(sizeof...(Columns) > 0,
+                  "MySQL: load_data requires at least one column");
+    static_assert((std::is_same_v<typename Columns::_table, Table> and ...),
+                  "MySQL: load_data columns must belong to the table");
+
+    context_t context(this);
+    auto query = "LOAD DATA LOCAL INFILE 'sqlpp23' INTO TABLE " +
+                 to_sql_string(context, table) + " (";
+    auto separator = std::string_view{};
+    ((query += separator,
+      query += sqlpp::name_to_sql_string(context, name_tag_of_t<Columns>{}),
+      separator = ", "),
+     ...);
+    query += ")";
+
+    auto escape_data = [this](std::string_view s) { return escape(s); };
+    using _source_t =
+        detail::load_data_source<Rows, decltype(escape_data),
+                                 parameter_value_t<data_type_of_t<Columns>>...>;
+    auto source = _source_t{rows, escape_data};
+
+    MYSQL* mysql = _handle.native_handle();
+    mysql_set_local_infile_handler(mysql, &_source_t::init, &_source_t::read,
+                                   &_source_t::end, &_source_t::error,
+                                   &source);
+    struct infile_handler_reset {
+      MYSQL* mysql;
+      ~infile_handler_reset() { mysql_set_local_infile_default(mysql); }
+    } reset{mysql};
+
+    detail::thread_init();
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::statement, "Executing: '{}'", query);
+    }
+    if (mysql_real_query(mysql, query.data(), query.size())) {
+      if (source.error()) {
+        std::rethrow_exception(source.error());
+      }
+      throw exception{mysql_error(mysql), mysql_errno(mysql)};
+    }
+
+    auto result = load_data_result{.affected_rows = mysql_affected_rows(mysql),
+                                   .warning_count = mysql_warning_count(mysql),
+                                   .warnings = {}};
+    if (result.warning_count > 0) {
+      result.warnings = fetch_warnings();
+    }
+    return result;
+  }
+
   //! start transaction
   void start_transaction() {
     execute_statement(_handle, "START TRANSACTION");
@@ -427,6 +753,31 @@ class connection_base : public sqlpp::connection {
   // Constructors
   connection_base() = default;
   connection_base(_handle_t handle) : _handle{std::move(handle)} {}
+
+  // Used by `cached` (see sqlpp::common_connection) and auto-parameterization.
+  static void _collect_literals(context_t& context, _literals_t& literals) {
+    context._literals = &literals;
+  }
+
+  // Literals occupy parameters of the prepared statement, too.
+  template <typename Statement>
+  _prepared_statement_t _prepare_cached(const std::string& statement,
+                                        const context_t& context) {
+    return prepare_impl(
+        statement, parameters_of_t<Statement>::size() + context._literals->size(),
+        active_parameters<Statement>(context._parameters));
+  }
+
+  // The binds refer to the literals, which are therefore kept in the prepared
+  // statement.
+  static void _bind_cached_literals(_prepared_statement_t& prepared,
+                                    _literals_t literals,
+                                    const std::vector<size_t>& positions) {
+    prepared._literals = std::move(literals);
+    for (size_t i = 0; i < prepared._literals.size(); ++i) {
+      prepared.bind_literal(positions[i], prepared._literals[i]);
+    }
+  }
 };
 
 inline auto context_t::escape(std::string_view t) -> std::string {
@@ -50,6 +50,13 @@ struct connection_config {
   std::string ssl_capath;
   std::string ssl_cipher;
   unsigned int read_timeout{0};
+  bool local_infile{false};  // required for connection_base::load_data
+  // Replace literal values by parameters when executing insert, update,
+  // delete_from, and execute directly. The statement is then prepared and
+  // executed with the literals bound to its parameters.
+  bool auto_parameterize{false};
+  // Number of statements cached by `cached` and `run_cached` (0: none).
+  size_t prepared_statement_cache_size{32};
   debug_logger debug;  // not compared
 
   bool operator==(const connection_config& other) const {
@@ -61,7 +68,11 @@ struct connection_config {
             other.ssl_cert == ssl_cert and other.ssl_ca == ssl_ca and
             other.ssl_capath == ssl_capath and
             other.ssl_cipher == ssl_cipher and
-            +other.read_timeout == read_timeout);
+            +other.read_timeout == read_timeout and
+            other.local_infile == local_infile and
+            other.auto_parameterize == auto_parameterize and
+            other.prepared_statement_cache_size ==
+                prepared_statement_cache_size);
   }
 
   bool operator!=(const connection_config& other) const {
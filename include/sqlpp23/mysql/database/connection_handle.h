@@ -30,6 +30,7 @@
 
 #include <memory>
 
+#include <sqlpp23/core/database/prepared_statement_cache.h>
 #include <sqlpp23/mysql/database/connection_config.h>
 #include <sqlpp23/mysql/database/exception.h>
 #include <sqlpp23/mysql/sqlpp_mysql.h>
@@ -47,6 +48,13 @@ inline void connect(MYSQL* mysql, const connection_config& config) {
     throw exception{mysql_error(mysql), mysql_errno(mysql)};
   }
 
+  if (config.local_infile) {
+    const unsigned int enable = 1;
+    if (mysql_options(mysql, MYSQL_OPT_LOCAL_INFILE, &enable)) {
+      throw exception{mysql_error(mysql), mysql_errno(mysql)};
+    }
+  }
+
   if (config.ssl) {
     if (!config.ssl_key.empty() &&
         mysql_options(mysql, MYSQL_OPT_SSL_KEY, config.ssl_key.c_str())) {
@@ -93,11 +101,19 @@ inline void connect(MYSQL* mysql, const connection_config& config) {
 struct connection_handle {
   std::shared_ptr<const connection_config> config;
   std::unique_ptr<MYSQL, void (*)(MYSQL*)> mysql;
+#ifdef SQLPP_USE_MARIADB
+  bool nonblocking{false};
+#endif
+  // Declared after mysql, so that statements are closed before the
+  // connection.
+  sqlpp::detail::prepared_statement_cache prepared_statements;
 
   connection_handle() : config{}, mysql{nullptr, mysql_close} {}
 
   connection_handle(const std::shared_ptr<const connection_config>& conf)
-      : config{conf}, mysql{mysql_init(nullptr), mysql_close} {
+      : config{conf},
+        mysql{mysql_init(nullptr), mysql_close},
+        prepared_statements{conf->prepared_statement_cache_size} {
     if (not mysql) {
       throw sqlpp::exception{"MySQL: could not init mysql data structure"};
     }
@@ -108,7 +124,16 @@ struct connection_handle {
   connection_handle(const connection_handle&) = delete;
   connection_handle(connection_handle&&) = default;
   connection_handle& operator=(const connection_handle&) = delete;
-  connection_handle& operator=(connection_handle&&) = default;
+  connection_handle& operator=(connection_handle&& rhs) {
+    // Close cached statements before closing the connection.
+    prepared_statements = std::move(rhs.prepared_statements);
+    config = std::move(rhs.config);
+    mysql = std::move(rhs.mysql);
+#ifdef SQLPP_USE_MARIADB
+    nonblocking = rhs.nonblocking;
+#endif
+    return *this;
+  }
 
   MYSQL* native_handle() const { return mysql.get(); }
 
@@ -124,5 +149,19 @@ struct connection_handle {
   }
 
   const debug_logger& debug() { return config->debug; }
+
+#ifdef SQLPP_USE_MARIADB
+  // Required for the non-blocking API, see async_query_t
+  void enable_nonblocking() {
+    if (nonblocking) {
+      return;
+    }
+    if (mysql_options(native_handle(), MYSQL_OPT_NONBLOCK, 0)) {
+      throw exception{mysql_error(native_handle()),
+                      mysql_errno(native_handle())};
+    }
+    nonblocking = true;
+  }
+#endif
 };
 }  // namespace sqlpp::mysql::detail
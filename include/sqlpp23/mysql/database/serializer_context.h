@@ -27,13 +27,32 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <typeindex>
+#include <variant>
+#include <vector>
+
+#include <sqlpp23/core/chrono.h>
 
 namespace sqlpp::mysql {
 
 class connection_base;
 
+namespace detail {
+// Value of a literal that is replaced by a parameter, see
+// connection_config::auto_parameterize.
+using literal_parameter = std::variant<int64_t,
+                                       uint64_t,
+                                       double,
+                                       std::string,
+                                       std::chrono::sys_days,
+                                       ::sqlpp::chrono::sys_microseconds,
+                                       std::chrono::microseconds>;
+}  // namespace detail
+
 // Context for serialization
 struct context_t {
   explicit context_t(connection_base* db) : _db(db) {}
@@ -46,6 +65,10 @@ struct context_t {
   auto escape(std::string_view t) -> std::string;
 
   connection_base* _db;
+  // Parameters in order of serialization, see sqlpp::record_parameter.
+  std::vector<std::type_index> _parameters;
+  // If set, literal values are serialized as parameters and collected here.
+  std::vector<detail::literal_parameter>* _literals = nullptr;
 };
 
 }  // namespace sqlpp::postgresql
@@ -0,0 +1,223 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <errmsg.h>
+
+#include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/detail/value_codec.h>
+#include <sqlpp23/core/type_traits/optional.h>
+#include <sqlpp23/core/wrong.h>
+#include <sqlpp23/mysql/database/exception.h>
+#include <sqlpp23/mysql/sqlpp_mysql.h>
+
+namespace sqlpp::mysql {
+struct load_data_result {
+  uint64_t affected_rows;
+  unsigned int warning_count;
+  // Messages as reported by SHOW WARNINGS (limited by max_error_count).
+  std::vector<std::string> warnings;
+};
+}  // namespace sqlpp::mysql
+
+namespace sqlpp::mysql::detail {
+// Appends a field in the default format of LOAD DATA: Fields are terminated by
+// tab, lines by newline, `\` is the escape character, and `\N` is NULL.
+template <typename Value, typename Arg, typename Escape>
+void append_load_data_field(std::string& line,
+                            const Arg& arg,
+                            const Escape& escape) {
+  if constexpr (is_optional<Value>::value) {
+    if constexpr (std::is_same_v<Arg, std::nullopt_t>) {
+      line += "\\N";
+    } else if constexpr (is_optional<Arg>::value) {
+      if (arg.has_value()) {
+        append_load_data_field<typename Value::value_type>(line, *arg, escape);
+      } else {
+        line += "\\N";
+      }
+    } else {
+      append_load_data_field<typename Value::value_type>(line, arg, escape);
+    }
+  } else if constexpr (std::is_same_v<Value, std::string> or
+                       std::is_same_v<Value, std::vector<uint8_t>>) {
+    std::string_view data;
+    if constexpr (std::is_same_v<Value, std::string>) {
+      data = std::string_view{arg};
+    } else {
+      const auto bytes = std::span<const uint8_t>{arg};
+      data = std::string_view{reinterpret_cast<const char*>(bytes.data()),
+                              bytes.size()};
+    }
+    // escape() takes care of `\`, newlines, and NUL, but not of tabs.
+    for (const char c : escape(data)) {
+      if (c == '\t') {
+        line += "\\t";
+      } else {
+        line += c;
+      }
+    }
+  } else if constexpr (std::is_same_v<Value, bool>) {
+    line += arg ? '1' : '0';
+  } else if constexpr (std::is_same_v<Value, int64_t> or
+                       std::is_same_v<Value, uint64_t>) {
+    ::sqlpp::detail::append_integral(line, static_cast<Value>(arg));
+  } else if constexpr (std::is_same_v<Value, double>) {
+    const auto value = static_cast<double>(arg);
+    if (not std::isfinite(value)) {
+      throw sqlpp::exception{"MySQL: load_data cannot load NaN or Infinity"};
+    }
+    ::sqlpp::detail::append_floating_point(line, value);
+  } else if constexpr (std::is_same_v<Value, std::chrono::sys_days>) {
+    ::sqlpp::detail::append_date(line, Value{arg});
+  } else if constexpr (std::is_same_v<Value,
+                                      ::sqlpp::chrono::sys_microseconds>) {
+    ::sqlpp::detail::append_timestamp(line, Value{arg});
+  } else if constexpr (std::is_same_v<Value, std::chrono::microseconds>) {
+    ::sqlpp::detail::append_time_of_day(line, Value{arg});
+  } else {
+    static_assert(wrong_t<Value>::value,
+                  "MySQL: unsupported column type for load_data");
+  }
+}
+
+// Generates the input of LOAD DATA LOCAL INFILE from a range of rows, one
+// line at a time. Used as userdata of mysql_set_local_infile_handler.
+template <typename Rows, typename Escape, typename... Values>
+class load_data_source {
+  using _iterator_t = decltype(std::ranges::begin(std::declval<const Rows&>()));
+  using _sentinel_t = decltype(std::ranges::end(std::declval<const Rows&>()));
+
+  _iterator_t _current;
+  _sentinel_t _end;
+  Escape _escape;
+  std::string _line;
+  size_t _offset = 0;
+  std::exception_ptr _error;
+
+ public:
+  load_data_source(const Rows& rows, Escape escape)
+      : _current{std::ranges::begin(rows)},
+        _end{std::ranges::end(rows)},
+        _escape{std::move(escape)} {}
+
+  const std::exception_ptr& error() const { return _error; }
+
+  static int init(void** ptr, const char* /*filename*/, void* userdata) {
+    *ptr = userdata;
+    return 0;
+  }
+
+  // Returns the number of bytes written to `buffer`, 0 at the end of the
+  // input, and -1 in case of an error.
+  static int read(void* ptr, char* buffer, unsigned int size) {
+    return static_cast<load_data_source*>(ptr)->_read(buffer, size);
+  }
+
+  static void end(void* /*ptr*/) {}
+
+  static int error(void* ptr, char* message, unsigned int size) {
+    auto& source = *static_cast<load_data_source*>(ptr);
+    std::string_view text = "Could not generate data";
+    std::string what;
+    if (source._error) {
+      try {
+        std::rethrow_exception(source._error);
+      } catch (const std::exception& e) {
+        what = e.what();
+        text = what;
+      } catch (...) {
+      }
+    }
+    if (size > 0) {
+      const auto length = std::min<size_t>(text.size(), size - 1);
+      std::memcpy(message, text.data(), length);
+      message[length] = '\0';
+    }
+    return CR_UNKNOWN_ERROR;
+  }
+
+ private:
+  int _read(char* buffer, unsigned int size) {
+    try {
+      while (_offset == _line.size()) {
+        if (_current == _end) {
+          return 0;
+        }
+        _line.clear();
+        _offset = 0;
+        _append_row(*_current, std::index_sequence_for<Values...>{});
+        ++_current;
+      }
+      const auto length = std::min<size_t>(_line.size() - _offset, size);
+      std::memcpy(buffer, _line.data() + _offset, length);
+      _offset += length;
+      return static_cast<int>(length);
+    } catch (...) {
+      _error = std::current_exception();
+      return -1;
+    }
+  }
+
+  template <typename Row, size_t... Is>
+  void _append_row(const Row& row, std::index_sequence<Is...>) {
+    static_assert(std::tuple_size_v<Row> == sizeof...(Values),
+                  "MySQL: number of values in row does not match the number "
+                  "of columns passed to load_data");
+    (_append_field<Is>(row), ...);
+    _line += '\n';
+  }
+
+  template <size_t I, typename Row>
+  void _append_field(const Row& row) {
+    if constexpr (I > 0) {
+      _line += '\t';
+    }
+    using std::get;
+    append_load_data_field<std::tuple_element_t<I, std::tuple<Values...>>>(
+        _line, get<I>(row), _escape);
+  }
+};
+}  // namespace sqlpp::mysql::detail
@@ -27,8 +27,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/database/parameter_list.h>
 #include <sqlpp23/mysql/database/connection_config.h>
+#include <sqlpp23/mysql/database/serializer_context.h>
 #include <sqlpp23/mysql/database/exception.h>
 #include <sqlpp23/mysql/sqlpp_mysql.h>
 
@@ -48,10 +55,54 @@ struct wrapped_bool {
   ~wrapped_bool() = default;
 };
 
+inline MYSQL_TIME to_mysql_time(const std::chrono::sys_days& value) {
+  auto result = MYSQL_TIME{};
+  const auto ymd = std::chrono::year_month_day{value};
+  result.year = static_cast<unsigned>(std::abs(static_cast<int>(ymd.year())));
+  result.month = static_cast<unsigned>(ymd.month());
+  result.day = static_cast<unsigned>(ymd.day());
+  return result;
+}
+
+inline MYSQL_TIME to_mysql_time(
+    const ::sqlpp::chrono::sys_microseconds& value) {
+  const auto dp = std::chrono::floor<std::chrono::days>(value);
+  const auto time = std::chrono::hh_mm_ss(
+      std::chrono::floor<::std::chrono::microseconds>(value - dp));
+  auto result = to_mysql_time(dp);
+  result.hour = static_cast<unsigned>(time.hours().count());
+  result.minute = static_cast<unsigned>(time.minutes().count());
+  result.second = static_cast<unsigned>(time.seconds().count());
+  result.second_part = static_cast<unsigned long>(time.subseconds().count());
+  return result;
+}
+
+inline MYSQL_TIME to_mysql_time(const ::std::chrono::microseconds& value) {
+  const auto dp = std::chrono::floor<std::chrono::days>(value);
+  const auto time = std::chrono::hh_mm_ss(
+      std::chrono::floor<::std::chrono::microseconds>(value - dp));
+  auto result = MYSQL_TIME{};
+  result.hour = static_cast<unsigned>(time.hours().count());
+  result.minute = static_cast<unsigned>(time.minutes().count());
+  result.second = static_cast<unsigned>(time.seconds().count());
+  result.second_part = static_cast<unsigned long>(time.subseconds().count());
+  return result;
+}
+
 }  // namespace detail
 
 class connection_base;
 
+// Options that can be passed to `connection_base::prepare`.
+struct prepare_options {
+  // Execute the statement with a read-only server side cursor. Result rows are
+  // then fetched from the server in batches of `prefetch_rows` rows instead of
+  // being sent to the client all at once.
+  bool read_only_cursor = false;
+  // Number of rows to fetch per round trip when using a cursor.
+  unsigned long prefetch_rows = 1;
+};
+
 class prepared_statement_t {
   friend ::sqlpp::mysql::connection_base;
 
@@ -95,7 +146,7 @@ class prepared_statement_t {
   ~prepared_statement_t() = default;
 
   std::shared_ptr<MYSQL_STMT> native_handle() const { return mysql_stmt; }
-  std::vector<MYSQL_BIND> parameters() { return stmt_params; }
+  std::vector<MYSQL_BIND>& parameters() { return stmt_params; }
 
   const debug_logger& debug() { return _config->debug; }
 
@@ -105,6 +156,33 @@ class prepared_statement_t {
 
   void _pre_bind();
 
+  void set_options(const prepare_options& options) {
+    const unsigned long cursor_type = options.read_only_cursor
+                                          ? CURSOR_TYPE_READ_ONLY
+                                          : CURSOR_TYPE_NO_CURSOR;
+    if (mysql_stmt_attr_set(native_handle().get(), STMT_ATTR_CURSOR_TYPE,
+                            &cursor_type)) {
+      throw exception{mysql_stmt_error(native_handle().get()),
+                      mysql_stmt_errno(native_handle().get())};
+    }
+    if (options.read_only_cursor) {
+      if (options.prefetch_rows == 0) {
+        throw sqlpp::exception{"MySQL: prefetch_rows must be at least 1"};
+      }
+      if (mysql_stmt_attr_set(native_handle().get(), STMT_ATTR_PREFETCH_ROWS,
+                              &options.prefetch_rows)) {
+        throw exception{mysql_stmt_error(native_handle().get()),
+                        mysql_stmt_errno(native_handle().get())};
+      }
+    }
+    if constexpr (debug_enabled) {
+      debug().log(log_category::statement,
+                  "set prepared statement options: read_only_cursor={}, "
+                  "prefetch_rows={}",
+                  options.read_only_cursor, options.prefetch_rows);
+    }
+  }
+
   void bind_parameter(size_t parameter_index, const bool& value) {
     stmt_param_is_null[parameter_index] = false;
     MYSQL_BIND& param{stmt_params[parameter_index]};
@@ -168,15 +246,7 @@ class prepared_statement_t {
   void bind_parameter(size_t parameter_index,
                       const std::chrono::sys_days& value) {
     auto& bound_time = stmt_date_time_param_buffer[parameter_index];
-    const auto ymd = std::chrono::year_month_day{value};
-    bound_time.year =
-        static_cast<unsigned>(std::abs(static_cast<int>(ymd.year())));
-    bound_time.month = static_cast<unsigned>(ymd.month());
-    bound_time.day = static_cast<unsigned>(ymd.day());
-    bound_time.hour = 0u;
-    bound_time.minute = 0u;
-    bound_time.second = 0u;
-    bound_time.second_part = 0u;
+    bound_time = detail::to_mysql_time(value);
     if constexpr (debug_enabled) {
       debug().log(log_category::parameter, "bound values: {}-{}-{}T{}:{}:{}.{}",
                   bound_time.year, bound_time.month, bound_time.day,
@@ -198,19 +268,7 @@ class prepared_statement_t {
   void bind_parameter(size_t parameter_index,
                       const ::sqlpp::chrono::sys_microseconds& value) {
     auto& bound_time = stmt_date_time_param_buffer[parameter_index];
-    const auto dp = std::chrono::floor<std::chrono::days>(value);
-    const auto time = std::chrono::hh_mm_ss(
-        std::chrono::floor<::std::chrono::microseconds>(value - dp));
-    const auto ymd = std::chrono::year_month_day{dp};
-    bound_time.year =
-        static_cast<unsigned>(std::abs(static_cast<int>(ymd.year())));
-    bound_time.month = static_cast<unsigned>(ymd.month());
-    bound_time.day = static_cast<unsigned>(ymd.day());
-    bound_time.hour = static_cast<unsigned>(time.hours().count());
-    bound_time.minute = static_cast<unsigned>(time.minutes().count());
-    bound_time.second = static_cast<unsigned>(time.seconds().count());
-    bound_time.second_part =
-        static_cast<unsigned long>(time.subseconds().count());
+    bound_time = detail::to_mysql_time(value);
     if constexpr (debug_enabled) {
       debug().log(log_category::parameter, "bound values: {}-{}-{}T{}:{}:{}.{}",
                   bound_time.year, bound_time.month, bound_time.day,
@@ -232,17 +290,7 @@ class prepared_statement_t {
   void bind_parameter(size_t parameter_index,
                       const ::std::chrono::microseconds& value) {
     auto& bound_time = stmt_date_time_param_buffer[parameter_index];
-    const auto dp = std::chrono::floor<std::chrono::days>(value);
-    const auto time = std::chrono::hh_mm_ss(
-        std::chrono::floor<::std::chrono::microseconds>(value - dp));
-    bound_time.year = 0u;
-    bound_time.month = 0u;
-    bound_time.day = 0u;
-    bound_time.hour = static_cast<unsigned>(time.hours().count());
-    bound_time.minute = static_cast<unsigned>(time.minutes().count());
-    bound_time.second = static_cast<unsigned>(time.seconds().count());
-    bound_time.second_part =
-        static_cast<unsigned long>(time.subseconds().count());
+    bound_time = detail::to_mysql_time(value);
     if constexpr (debug_enabled) {
       debug().log(log_category::parameter, "bound values: {}-{}-{}T{}:{}:{}.{}",
                   bound_time.year, bound_time.month, bound_time.day,
@@ -277,6 +325,29 @@ class prepared_statement_t {
     param.is_unsigned = false;
     param.error = nullptr;
   }
+
+  // Binds a literal that was replaced by a parameter, see
+  // connection_config::auto_parameterize. The bind refers to the literal, which
+  // therefore has to outlive the execution.
+  void bind_literal(size_t parameter_index,
+                    const detail::literal_parameter& literal) {
+    std::visit(
+        [&](const auto& value) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(value)>,
+                                       std::string>) {
+            bind_parameter(parameter_index, std::string_view{value});
+          } else {
+            bind_parameter(parameter_index, value);
+          }
+        },
+        literal);
+  }
+
+  // Positions of the parameters in the prepared statement (empty if all are
+  // in list order), see sqlpp::active_parameters.
+  parameter_positions_t _active_parameters;
+  // Literals bound by `cached`, see bind_literal.
+  std::vector<detail::literal_parameter> _literals;
 };
 
 inline void bind_parameter(prepared_statement_t& statement,
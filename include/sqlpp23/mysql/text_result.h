@@ -27,7 +27,6 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <cstdlib>
 #include <memory>
 #include <span>
 #include <string_view>
@@ -35,6 +34,7 @@
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/mysql/text_result_row.h>
 #include <sqlpp23/mysql/database/connection_config.h>
@@ -129,15 +129,24 @@ class text_result_t {
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, double& value) {
-    value = std::strtod(result.get_field_value(field_index), nullptr);
+    ::sqlpp::detail::parse_number(
+        std::string_view(result.get_field_value(field_index),
+                         result.get_field_length(field_index)),
+        value);
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, int64_t& value) {
-    value = std::strtoll(result.get_field_value(field_index), nullptr, 10);
+    ::sqlpp::detail::parse_number(
+        std::string_view(result.get_field_value(field_index),
+                         result.get_field_length(field_index)),
+        value);
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, uint64_t& value) {
-    value = std::strtoull(result.get_field_value(field_index), nullptr, 10);
+    ::sqlpp::detail::parse_number(
+        std::string_view(result.get_field_value(field_index),
+                         result.get_field_length(field_index)),
+        value);
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, std::span<const uint8_t>& value) {
@@ -27,6 +27,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <sqlpp23/core/basic/parameter.h>
+#include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/database/parameter_list.h>
 #include <sqlpp23/core/operator/comparison_expression.h>
 #include <sqlpp23/core/reader.h>
 #include <sqlpp23/core/type_traits/data_type.h>
@@ -34,22 +43,157 @@
 #include <sqlpp23/sqlpp23.h>
 
 namespace sqlpp::mysql {
-template <typename L, typename R>
+// Serialize parameters
+template <typename DataType, typename NameType>
 auto to_sql_string(mysql::context_t& context,
-                   const comparison_expression<L, sqlpp::op_is_distinct_from, R>& t)
+                   const parameter_t<DataType, NameType>&) -> std::string {
+  record_parameter<parameter_t<DataType, NameType>>(context._parameters);
+  return "?";
+}
+
+namespace detail {
+// Replaces the literal by a parameter if the context collects literals (see
+// connection_config::auto_parameterize). Otherwise, the literal is serialized
+// as usual.
+template <typename T>
+auto literal_to_sql_string(mysql::context_t& context, const T& t)
     -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = "NOT (" + operand_to_sql_string(context, read.lhs(t)) + " <=> ";
-  return ret_val + operand_to_sql_string(context, read.rhs(t)) + ")";
+  if (context._literals) {
+    if constexpr (std::is_floating_point_v<T>) {
+      // NaN and Infinity are handled (i.e. rejected) as usual.
+      if (not std::isfinite(t)) {
+        return ::sqlpp::to_sql_string(context, t);
+      }
+      context._literals->emplace_back(static_cast<double>(t));
+    } else if constexpr (std::is_same_v<T, std::string_view>) {
+      context._literals->emplace_back(std::string{t});
+    } else if constexpr (std::is_same_v<T, std::chrono::sys_days> or
+                         std::is_same_v<T, ::sqlpp::chrono::sys_microseconds> or
+                         std::is_same_v<T, std::chrono::microseconds>) {
+      context._literals->emplace_back(t);
+    } else if constexpr (std::is_unsigned_v<T>) {
+      context._literals->emplace_back(static_cast<uint64_t>(t));
+    } else {
+      context._literals->emplace_back(static_cast<int64_t>(t));
+    }
+    record_literal(context._parameters);
+    return "?";
+  }
+  return ::sqlpp::to_sql_string(context, t);
 }
+}  // namespace detail
 
-template <typename L, typename R>
-auto to_sql_string(mysql::context_t& context,
-                   const comparison_expression<L, sqlpp::op_is_not_distinct_from, R>& t)
+inline auto to_sql_string(mysql::context_t& context, const bool& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const int8_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const int16_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const int32_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const int64_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const uint8_t& t)
     -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = operand_to_sql_string(context, read.lhs(t)) + " <=> ";
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const uint16_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const uint32_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const uint64_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const float& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const double& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context, const long double& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+// Text literals of other types (e.g. std::string) are serialized as
+// std::string_view. Blob literals are always serialized inline.
+inline auto to_sql_string(mysql::context_t& context, const std::string_view& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+template <typename Period>
+auto to_sql_string(
+    mysql::context_t& context,
+    const std::chrono::time_point<std::chrono::system_clock, Period>& t)
+    -> std::string {
+  if (context._literals) {
+    return detail::literal_to_sql_string(
+        context, ::sqlpp::chrono::sys_microseconds{
+                     std::chrono::floor<std::chrono::microseconds>(t)});
+  }
+  return ::sqlpp::to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context,
+                          const std::chrono::microseconds& t) -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(mysql::context_t& context,
+                          const std::chrono::sys_days& t) -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+template <typename L, typename R>
+auto append_sql_string(
+    mysql::context_t& context,
+    std::string& out,
+    const comparison_expression<L, sqlpp::op_is_distinct_from, R>& t) -> void {
+  out += "NOT (";
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += " <=> ";
+  append_operand_sql_string(context, out, read.rhs(t));
+  out += ')';
+}
+
+template <typename L, typename R>
+auto append_sql_string(
+    mysql::context_t& context,
+    std::string& out,
+    const comparison_expression<L, sqlpp::op_is_not_distinct_from, R>& t)
+    -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += " <=> ";
+  append_operand_sql_string(context, out, read.rhs(t));
 }
 
 inline auto to_sql_string(mysql::context_t&, const insert_default_values_t&)
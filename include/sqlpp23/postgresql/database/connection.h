@@ -29,13 +29,17 @@
  */
 
 #include <memory>
+#include <string>
+#include <vector>
 #include <sqlpp23/core/query/statement.h>
 #include <sqlpp23/core/type_traits.h>
 
 #include <sqlpp23/core/database/connection.h>
 #include <sqlpp23/core/database/exception.h>
+#include <sqlpp23/core/database/parameter_list.h>
 #include <sqlpp23/core/database/transaction.h>
 #include <sqlpp23/core/query/statement_constructor_arg.h>
+#include <sqlpp23/core/query/static_sql.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/postgresql/database/connection_config.h>
 #include <sqlpp23/postgresql/database/connection_handle.h>
@@ -87,6 +91,8 @@ class connection_base : public sqlpp::connection {
   using _handle_t = detail::connection_handle;
 
   using _prepared_statement_t = prepared_statement_t;
+  using _context_t = context_t;
+  using _literals_t = std::vector<std::string>;
 
  private:
   friend class sqlpp::statement_handler_t;
@@ -99,37 +105,77 @@ class connection_base : public sqlpp::connection {
     }
   }
 
+  // Literals are replaced by parameters if enabled, see
+  // connection_config::auto_parameterize.
+  void collect_literals(context_t& context, std::vector<std::string>& literals) {
+    if (_handle.config->auto_parameterize) {
+      _collect_literals(context, literals);
+    }
+  }
+
   // direct execution
-  pg_result_t _execute_impl(std::string_view stmt) {
+  pg_result_t _execute_impl(std::string_view stmt,
+                            const std::vector<std::string>& literals = {}) {
     validate_connection_handle();
     if constexpr (debug_enabled) {
       _handle.debug().log(log_category::statement, "executing: '{}'", stmt);
     }
 
-    return pg_result_t{PQexec(native_handle(), stmt.data())};
+    if (literals.empty()) {
+      return pg_result_t{PQexec(native_handle(), stmt.data())};
+    }
+
+    // Literals are sent in text format, their types are determined by the
+    // casts in the statement.
+    auto values = std::vector<const char*>{};
+    values.reserve(literals.size());
+    for (const auto& literal : literals) {
+      values.push_back(literal.c_str());
+    }
+    return pg_result_t{PQexecParams(native_handle(), stmt.data(),
+                                    static_cast<int>(values.size()), nullptr,
+                                    values.data(), nullptr, nullptr, 0)};
+  }
+
+  text_result_t select_impl(const std::string& stmt,
+                            const std::vector<std::string>& literals) {
+    return {_execute_impl(stmt, literals), _handle.config.get()};
   }
 
-  text_result_t select_impl(const std::string& stmt) {
-    return {_execute_impl(stmt), _handle.config.get()};
+  command_result insert_impl(const std::string& stmt,
+                             const std::vector<std::string>& literals) {
+    return {.affected_rows = _execute_impl(stmt, literals).affected_rows()};
   }
 
-  command_result insert_impl(const std::string& stmt) {
-    return {.affected_rows = _execute_impl(stmt).affected_rows()};
+  command_result update_impl(const std::string& stmt,
+                             const std::vector<std::string>& literals) {
+    return {.affected_rows = _execute_impl(stmt, literals).affected_rows()};
   }
 
-  command_result update_impl(const std::string& stmt) {
-    return {.affected_rows = _execute_impl(stmt).affected_rows()};
+  command_result delete_from_impl(const std::string& stmt,
+                                  const std::vector<std::string>& literals) {
+    return {.affected_rows = _execute_impl(stmt, literals).affected_rows()};
   }
 
-  command_result delete_from_impl(const std::string& stmt) {
-    return {.affected_rows = _execute_impl(stmt).affected_rows()};
+  // Static SQL is not serialized again, so the context does not count the
+  // parameters in that case.
+  template <typename Statement>
+  static size_t parameter_count(const context_t& context) {
+    if constexpr (has_static_sql<Statement>::value) {
+      return parameters_of_t<Statement>::size();
+    } else {
+      return context._count;
+    }
   }
 
   // prepared execution
   prepared_statement_t prepare_impl(const std::string& stmt,
-                                    const size_t& param_count) {
+                                    const size_t& param_count,
+                                    parameter_positions_t active) {
     validate_connection_handle();
-    return prepare_statement(_handle, stmt, param_count);
+    auto prepared = prepare_statement(_handle, stmt, param_count);
+    prepared._active_parameters = std::move(active);
+    return prepared;
   }
 
   text_result_t run_prepared_select_impl(prepared_statement_t& prep) {
@@ -166,14 +212,20 @@ class connection_base : public sqlpp::connection {
   template <typename Select>
   text_result_t _select(const Select& s) {
     context_t context(this);
-    return select_impl(to_sql_string(context, s));
+    auto literals = std::vector<std::string>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    return select_impl(statement_sql_string(context, s, buffer), literals);
   }
 
   // Prepared select
   template <typename Select>
   _prepared_statement_t _prepare_select(const Select& s) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return prepare_impl(query, parameter_count<Select>(context),
+                        active_parameters<Select>(context._parameters));
   }
 
   template <typename PreparedSelect>
@@ -187,13 +239,19 @@ class connection_base : public sqlpp::connection {
   template <typename Insert>
   command_result _insert(const Insert& s) {
     context_t context(this);
-    return insert_impl(to_sql_string(context, s));
+    auto literals = std::vector<std::string>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    return insert_impl(statement_sql_string(context, s, buffer), literals);
   }
 
   template <typename Insert>
   prepared_statement_t _prepare_insert(const Insert& s) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return prepare_impl(query, parameter_count<Insert>(context),
+                        active_parameters<Insert>(context._parameters));
   }
 
   template <typename PreparedInsert>
@@ -207,13 +265,19 @@ class connection_base : public sqlpp::connection {
   template <typename Update>
   command_result _update(const Update& s) {
     context_t context(this);
-    return update_impl(to_sql_string(context, s));
+    auto literals = std::vector<std::string>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    return update_impl(statement_sql_string(context, s, buffer), literals);
   }
 
   template <typename Update>
   prepared_statement_t _prepare_update(const Update& s) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return prepare_impl(query, parameter_count<Update>(context),
+                        active_parameters<Update>(context._parameters));
   }
 
   template <typename PreparedUpdate>
@@ -227,13 +291,19 @@ class connection_base : public sqlpp::connection {
   template <typename Delete>
   command_result _delete_from(const Delete& s) {
     context_t context(this);
-    return delete_from_impl(to_sql_string(context, s));
+    auto literals = std::vector<std::string>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    return delete_from_impl(statement_sql_string(context, s, buffer), literals);
   }
 
   template <typename Delete>
   prepared_statement_t _prepare_delete_from(const Delete& s) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return prepare_impl(query, parameter_count<Delete>(context),
+                        active_parameters<Delete>(context._parameters));
   }
 
   template <typename PreparedDelete>
@@ -247,13 +317,22 @@ class connection_base : public sqlpp::connection {
   template <typename Execute>
   command_result _execute(const Execute& s) {
     context_t context(this);
-    return operator()(to_sql_string(context, s));
+    auto literals = std::vector<std::string>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    return {.affected_rows =
+                _execute_impl(statement_sql_string(context, s, buffer),
+                              literals)
+                    .affected_rows()};
   }
 
   template <typename Execute>
   _prepared_statement_t _prepare_execute(const Execute& s) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return prepare_impl(query, parameter_count<Execute>(context),
+                        active_parameters<Execute>(context._parameters));
   }
 
   template <typename PreparedExecute>
@@ -439,6 +518,27 @@ class connection_base : public sqlpp::connection {
   // Constructors
   connection_base() = default;
   connection_base(_handle_t handle) : _handle{std::move(handle)} {}
+
+  // Used by `cached` (see sqlpp::common_connection) and auto-parameterization.
+  static void _collect_literals(context_t& context, _literals_t& literals) {
+    context._literals = &literals;
+  }
+
+  template <typename Statement>
+  _prepared_statement_t _prepare_cached(const std::string& statement,
+                                        const context_t& context) {
+    return prepare_impl(statement, parameter_count<Statement>(context),
+                        active_parameters<Statement>(context._parameters));
+  }
+
+  // Literals are bound in text format, like parameters.
+  static void _bind_cached_literals(_prepared_statement_t& prepared,
+                                    _literals_t literals,
+                                    const std::vector<size_t>& positions) {
+    for (size_t i = 0; i < literals.size(); ++i) {
+      prepared.bind_parameter(positions[i], literals[i]);
+    }
+  }
 };
 
 inline auto context_t::escape(std::string_view t) -> std::string {
@@ -66,6 +66,11 @@ struct connection_config {
   std::string requirepeer;
   std::string krbsrvname;
   std::string service;
+  // Replace literal values by parameters in direct execution, so that values
+  // are sent separately from the SQL text (see PQexecParams).
+  bool auto_parameterize{false};
+  // Number of statements cached by `cached` and `run_cached` (0: none).
+  size_t prepared_statement_cache_size{32};
   // bool auto_reconnect {true};
   debug_logger debug; // not compared
 
@@ -85,7 +90,9 @@ struct connection_config {
         other.sslcert == sslcert && other.sslkey == sslkey &&
         other.sslrootcert == sslrootcert && other.sslcrl == sslcrl &&
         other.requirepeer == requirepeer && other.krbsrvname == krbsrvname &&
-        other.service == service);
+        other.service == service &&
+        other.auto_parameterize == auto_parameterize &&
+        other.prepared_statement_cache_size == prepared_statement_cache_size);
   }
   bool operator!=(const connection_config& other) { return !operator==(other); }
 };
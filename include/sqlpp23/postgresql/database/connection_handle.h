@@ -32,6 +32,7 @@
 
 #include <libpq-fe.h>
 
+#include <sqlpp23/core/database/prepared_statement_cache.h>
 #include <sqlpp23/postgresql/database/connection_config.h>
 #include <sqlpp23/postgresql/database/exception.h>
 
@@ -40,11 +41,16 @@ struct connection_handle {
   std::shared_ptr<const connection_config> config;
   std::unique_ptr<PGconn, void (*)(PGconn*)> postgres;
   size_t _prepared_statement_count = 0;
+  // Declared after postgres, so that statements are deallocated before the
+  // connection is closed.
+  sqlpp::detail::prepared_statement_cache prepared_statements;
 
   connection_handle() : config{}, postgres{nullptr, PQfinish} {}
 
   connection_handle(const std::shared_ptr<const connection_config>& conf)
-      : config{conf}, postgres{nullptr, PQfinish} {
+      : config{conf},
+        postgres{nullptr, PQfinish},
+        prepared_statements{conf->prepared_statement_cache_size} {
     if constexpr (debug_enabled) {
       config->debug.log(log_category::connection,
                         "connecting to the database server.");
@@ -164,7 +170,14 @@ struct connection_handle {
   }
 
   connection_handle& operator=(const connection_handle&) = delete;
-  connection_handle& operator=(connection_handle&&) = default;
+  connection_handle& operator=(connection_handle&& rhs) {
+    // Deallocate cached statements before closing the connection.
+    prepared_statements = std::move(rhs.prepared_statements);
+    config = std::move(rhs.config);
+    postgres = std::move(rhs.postgres);
+    _prepared_statement_count = rhs._prepared_statement_count;
+    return *this;
+  }
 
   std::string get_prepared_statement_name() {
     ++_prepared_statement_count;
@@ -31,6 +31,8 @@
 #include <cstddef>
 #include <string>
 #include <string_view>
+#include <typeindex>
+#include <vector>
 
 namespace sqlpp::postgresql {
 
@@ -49,6 +51,11 @@ struct context_t {
 
   size_t _count{0};
   connection_base* _db;
+  // Parameters in order of serialization, see sqlpp::record_parameter.
+  std::vector<std::type_index> _parameters;
+  // If set, literal values are serialized as parameters and collected here in
+  // text format, see connection_config::auto_parameterize.
+  std::vector<std::string>* _literals = nullptr;
 };
 
 }  // namespace sqlpp::postgresql
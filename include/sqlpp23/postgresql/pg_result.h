@@ -27,12 +27,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <cstdlib>
 #include <memory>
 
 #include <libpq-fe.h>
 #include <pg_config.h>
 
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/postgresql/database/exception.h>
 
 namespace sqlpp::postgresql {
@@ -66,7 +66,9 @@ class pg_result_t {
   PGresult* get() const { return _pg_result.get(); }
 
   size_t affected_rows() {
-    return std::strtoull(PQcmdTuples(_pg_result.get()), nullptr, 10);
+    auto result = size_t{};
+    ::sqlpp::detail::parse_number(PQcmdTuples(_pg_result.get()), result);
+    return result;
   }
 
 };
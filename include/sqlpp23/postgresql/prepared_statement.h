@@ -28,12 +28,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cmath>
 #include <string>
+#include <vector>
 
 #include <libpq-fe.h>
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/debug_logger.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/postgresql/database/connection_handle.h>
 #include <sqlpp23/postgresql/database/serializer_context.h>
@@ -48,7 +51,7 @@ class connection_base;
 // Detail namespace
 namespace detail {
 struct prepared_statement_handle_t;
-}
+}  // namespace detail
 
 class prepared_statement_t {
  private:
@@ -60,6 +63,7 @@ class prepared_statement_t {
    // Parameters
   std::vector<bool> _stmt_null_parameters;
   std::vector<std::string> _stmt_parameters;
+  std::vector<const char*> _stmt_values;
 
   const connection_config* _config;
 
@@ -74,6 +78,7 @@ class prepared_statement_t {
       : _connection{connection},_name{std::move(name)},
         _stmt_null_parameters(no_of_parameters, false),
         _stmt_parameters(no_of_parameters, std::string{}),
+        _stmt_values(no_of_parameters, nullptr),
         _config{config} {
     if constexpr (debug_enabled) {
       config->debug.log(log_category::statement,
@@ -107,17 +112,15 @@ class prepared_statement_t {
   pg_result_t execute() {
     const size_t size = _stmt_parameters.size();
 
-    std::vector<const char*> values;
-    values.reserve(size);
     for (size_t i = 0u; i < size; i++) {
-      values.push_back(_stmt_null_parameters[i] ? nullptr
-                                                : _stmt_parameters[i].c_str());
+      _stmt_values[i] =
+          _stmt_null_parameters[i] ? nullptr : _stmt_parameters[i].c_str();
     }
 
     // Execute prepared statement with the parameters.
     return pg_result_t{PQexecPrepared(_connection, /*stmtName*/ _name.data(),
                                  /*nParams*/ static_cast<int>(size),
-                                 /*paramValues*/ values.data(),
+                                 /*paramValues*/ _stmt_values.data(),
                                  /*paramLengths*/ nullptr,
                                  /*paramFormats*/ nullptr, /*resultFormat*/ 0)};
   }
@@ -135,15 +138,23 @@ class prepared_statement_t {
 
   void bind_parameter(size_t parameter_index, const double& value) {
     _stmt_null_parameters[parameter_index] = false;
-    context_t context{nullptr};
-    using sqlpp::to_sql_string;
-    _stmt_parameters[parameter_index] = to_sql_string(context, value);
+    if (std::isfinite(value)) {
+      auto& param = _stmt_parameters[parameter_index];
+      param.clear();
+      ::sqlpp::detail::append_floating_point(param, value);
+    } else {
+      context_t context{nullptr};
+      using sqlpp::to_sql_string;
+      _stmt_parameters[parameter_index] = to_sql_string(context, value);
+    }
   }
 
   void bind_parameter(size_t parameter_index, const int64_t& value) {
     // Assign values
     _stmt_null_parameters[parameter_index] = false;
-    _stmt_parameters[parameter_index] = std::to_string(value);
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
+    ::sqlpp::detail::append_integral(param, value);
   }
 
   void bind_parameter(size_t parameter_index, const std::string& value) {
@@ -154,8 +165,9 @@ class prepared_statement_t {
 
   void bind_parameter(size_t parameter_index, const std::chrono::sys_days& value) {
     _stmt_null_parameters[parameter_index] = false;
-    const auto ymd = std::chrono::year_month_day{value};
-    _stmt_parameters[parameter_index] = std::format("{}", ymd);
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
+    ::sqlpp::detail::append_date(param, value);
 
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
@@ -167,11 +179,12 @@ class prepared_statement_t {
   void bind_parameter(size_t parameter_index, const ::std::chrono::microseconds& value) {
     _stmt_null_parameters[parameter_index] = false;
     const auto dp = std::chrono::floor<std::chrono::days>(value);
-    const auto time = std::chrono::hh_mm_ss(
-        std::chrono::floor<::std::chrono::microseconds>(value - dp));
 
     // Timezone handling - always treat the local value as UTC.
-    _stmt_parameters[parameter_index] = std::format("{}+00", time);
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
+    ::sqlpp::detail::append_time_of_day(param, value - dp);
+    param += "+00";
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
                            "binding time parameter string: {}",
@@ -182,13 +195,11 @@ class prepared_statement_t {
   void bind_parameter(size_t parameter_index,
                        const ::sqlpp::chrono::sys_microseconds& value) {
     _stmt_null_parameters[parameter_index] = false;
-    const auto dp = std::chrono::floor<std::chrono::days>(value);
-    const auto time = std::chrono::hh_mm_ss(
-        std::chrono::floor<::std::chrono::microseconds>(value - dp));
-    const auto ymd = std::chrono::year_month_day{dp};
-
     // Timezone handling - always treat the local value as UTC.
-    _stmt_parameters[parameter_index] = std::format("{} {}+00", ymd, time);
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
+    ::sqlpp::detail::append_timestamp(param, value);
+    param += "+00";
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
                            "binding date_time parameter string: {}",
@@ -200,8 +211,9 @@ class prepared_statement_t {
     _stmt_null_parameters[parameter_index] = false;
     constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
                                     '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-    auto param = std::string(value.size() * 2 + 2,
-                             '\0');  // ()-init for correct constructor
+    // Encode in place to reuse the capacity of the parameter string.
+    auto& param = _stmt_parameters[parameter_index];
+    param.resize(value.size() * 2 + 2);
     param[0] = '\\';
     param[1] = 'x';
     auto i = size_t{1};
@@ -209,12 +221,12 @@ class prepared_statement_t {
       param[++i] = hex_chars[c >> 4];
       param[++i] = hex_chars[c & 0x0F];
     }
-    _stmt_parameters[parameter_index] = std::move(param);
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
                          "binding blob parameter string (up to 100 "
                          "chars): {}",
-                         _stmt_parameters[parameter_index].substr(0, 100));
+                         std::string_view{_stmt_parameters[parameter_index]}
+                             .substr(0, 100));
     }
   }
 
@@ -226,6 +238,10 @@ class prepared_statement_t {
     }
     _stmt_null_parameters[parameter_index] = true;
   }
+
+  // Positions of the parameters in the prepared statement (empty if all are
+  // in list order), see sqlpp::active_parameters.
+  parameter_positions_t _active_parameters;
 };
 
 inline void bind_parameter(prepared_statement_t& statement,
@@ -35,6 +35,7 @@
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/postgresql/database/connection_config.h>
 #include <sqlpp23/postgresql/database/exception.h>
@@ -157,7 +158,9 @@ class text_result_t {
   ~text_result_t() = default;
 
   size_t affected_rows() {
-    return std::strtoull(PQcmdTuples(_pg_result.get()), nullptr, 10);
+    auto result = size_t{};
+    ::sqlpp::detail::parse_number(PQcmdTuples(_pg_result.get()), result);
+    return result;
   }
 
   auto& debug() const { return _config->debug; }
@@ -227,7 +230,10 @@ inline void read_field(const text_result_t& result,
                        field_index);
   }
 
-  value = std::strtod(result.get_field_value(field_index), nullptr);
+  ::sqlpp::detail::parse_number(
+      std::string_view(result.get_field_value(field_index),
+                       result.get_field_length(field_index)),
+      value);
 }
 
 inline void read_field(const text_result_t& result,
@@ -238,7 +244,10 @@ inline void read_field(const text_result_t& result,
                        "reading integral result at index: {}", field_index);
   }
 
-  value = std::strtoll(result.get_field_value(field_index), nullptr, 10);
+  ::sqlpp::detail::parse_number(
+      std::string_view(result.get_field_value(field_index),
+                       result.get_field_length(field_index)),
+      value);
 }
 
 inline void read_field(const text_result_t& result,
@@ -251,7 +260,10 @@ inline void read_field(const text_result_t& result,
         field_index);
   }
 
-  value = std::strtoull(result.get_field_value(field_index), nullptr, 10);
+  ::sqlpp::detail::parse_number(
+      std::string_view(result.get_field_value(field_index),
+                       result.get_field_length(field_index)),
+      value);
 }
 
 inline void read_field(const text_result_t& result,
@@ -27,8 +27,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cmath>
+#include <span>
+#include <string>
+#include <string_view>
+
 #include <sqlpp23/core/basic/parameter.h>
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/database/parameter_list.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/postgresql/database/serializer_context.h>
 
@@ -37,42 +44,169 @@ namespace sqlpp::postgresql {
 template <typename DataType, typename NameType>
 auto to_sql_string(postgresql::context_t& context,
                    const parameter_t<DataType, NameType>&) -> std::string {
+  record_parameter<parameter_t<DataType, NameType>>(context._parameters);
   return std::string("$") + std::to_string(++context._count);
 }
 
-// MySQL and sqlite3 use x'...', but PostgreSQL uses '\x...' to encode
-// hexadecimal literals
-inline auto to_sql_string(postgresql::context_t&,
-                          const std::span<const uint8_t>& t) -> std::string {
+namespace detail {
+// Replaces a literal by a parameter, if the context collects literals (see
+// connection_config::auto_parameterize). `value` is the literal in text format,
+// `cast` preserves the type of the inline literal, e.g. "::bigint".
+inline auto literal_to_sql_string(context_t& context,
+                                  std::string value,
+                                  std::string_view cast) -> std::string {
+  context._literals->push_back(std::move(value));
+  record_literal(context._parameters);
+  auto result = std::string("$") + std::to_string(++context._count);
+  result += cast;
+  return result;
+}
+
+template <typename T>
+auto number_to_sql_string(context_t& context, const T& t, std::string_view cast)
+    -> std::string {
+  if (context._literals) {
+    if constexpr (std::is_floating_point_v<T>) {
+      // NaN and Infinity are handled (i.e. rejected) as usual.
+      if (not std::isfinite(t)) {
+        return ::sqlpp::to_sql_string(context, t);
+      }
+    }
+    return literal_to_sql_string(context, ::sqlpp::detail::number_to_string(t),
+                                 cast);
+  }
+  return ::sqlpp::to_sql_string(context, t);
+}
+
+inline auto hex_to_sql_string(const std::span<const uint8_t>& t,
+                              std::string_view prefix) -> std::string {
   constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
                                   '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-  auto result = std::string("'\\x");
+  auto result = std::string(prefix);
   result.reserve(t.size() * 2 + 4);
   for (const auto c : t) {
     result.push_back(hex_chars[c >> 4]);
     result.push_back(hex_chars[c & 0x0F]);
   }
-  result.push_back('\'');
+  return result;
+}
+}  // namespace detail
+
+inline auto to_sql_string(postgresql::context_t& context, const int8_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::bigint");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const int16_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::bigint");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const int32_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::bigint");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const int64_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::bigint");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const uint8_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::bigint");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const uint16_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::bigint");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const uint32_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::bigint");
+}
+
+// uint64_t values might be too large for BIGINT.
+inline auto to_sql_string(postgresql::context_t& context, const uint64_t& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::numeric");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const float& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::double precision");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const double& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::double precision");
+}
+
+inline auto to_sql_string(postgresql::context_t& context, const long double& t)
+    -> std::string {
+  return detail::number_to_sql_string(context, t, "::double precision");
+}
+
+// Text literals of other types (e.g. std::string) are serialized as
+// std::string_view. Parameters without a type are resolved like quoted
+// literals.
+inline auto to_sql_string(postgresql::context_t& context,
+                          const std::string_view& t) -> std::string {
+  if (context._literals) {
+    return detail::literal_to_sql_string(context, std::string(t), "");
+  }
+  return ::sqlpp::to_sql_string(context, t);
+}
 
+// MySQL and sqlite3 use x'...', but PostgreSQL uses '\x...' to encode
+// hexadecimal literals
+inline auto to_sql_string(postgresql::context_t& context,
+                          const std::span<const uint8_t>& t) -> std::string {
+  if (context._literals) {
+    return detail::literal_to_sql_string(
+        context, detail::hex_to_sql_string(t, "\\x"), "::bytea");
+  }
+  auto result = detail::hex_to_sql_string(t, "'\\x");
+  result.push_back('\'');
   return result;
 }
 
 template <typename Period>
 auto to_sql_string(
-    postgresql::context_t&,
+    postgresql::context_t& context,
     const std::chrono::time_point<std::chrono::system_clock, Period>& t)
     -> std::string {
-  return std::format("TIMESTAMP WITH TIME ZONE '{0:%Y-%m-%d %H:%M:%S+00}'", t);
+  auto value = std::string{};
+  ::sqlpp::detail::append_timestamp(value, t);
+  value += "+00";
+  if (context._literals) {
+    return detail::literal_to_sql_string(context, std::move(value),
+                                         "::timestamp with time zone");
+  }
+  return "TIMESTAMP WITH TIME ZONE '" + value + "'";
 }
 
-inline auto to_sql_string(postgresql::context_t&,
+inline auto to_sql_string(postgresql::context_t& context,
                           const std::chrono::sys_days& t) -> std::string {
-  return std::format("DATE '{0:%Y-%m-%d}'", t);
+  auto value = std::string{};
+  ::sqlpp::detail::append_date(value, t);
+  if (context._literals) {
+    return detail::literal_to_sql_string(context, std::move(value), "::date");
+  }
+  return "DATE '" + value + "'";
 }
 
-inline auto to_sql_string(postgresql::context_t&,
+inline auto to_sql_string(postgresql::context_t& context,
                           const std::chrono::microseconds& t) -> std::string {
-  return std::format("TIME WITH TIME ZONE'{0:%H:%M:%S+00}'", t);
+  auto value = std::string{};
+  ::sqlpp::detail::append_time_of_day(value, t);
+  value += "+00";
+  if (context._literals) {
+    return detail::literal_to_sql_string(context, std::move(value),
+                                         "::time with time zone");
+  }
+  return "TIME WITH TIME ZONE'" + value + "'";
 }
 
 inline auto data_type_to_sql_string(postgresql::context_t&,
@@ -82,7 +216,11 @@ inline auto data_type_to_sql_string(postgresql::context_t&,
 
 // This has to be a template to prevent other numeric types to be narrowed into
 // bool here.
-inline auto to_sql_string(postgresql::context_t&, const bool& t) -> std::string {
+inline auto to_sql_string(postgresql::context_t& context, const bool& t)
+    -> std::string {
+  if (context._literals) {
+    return detail::literal_to_sql_string(context, t ? "t" : "f", "::boolean");
+  }
   return t ? "'t'::boolean" : "'f'::boolean";
 }
 
@@ -39,6 +39,7 @@
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/sqlite3/database/connection_config.h>
 #include <sqlpp23/sqlite3/database/exception.h>
@@ -153,6 +154,8 @@ class bind_result_t {
       case SQLITE_ROW:
         return true;
       case SQLITE_DONE:
+        detail::report_statement_status(_config->statement_status_callback,
+                                        _sqlite3_statement.get());
         return false;
       default:
         throw exception{std::string(sqlite3_errmsg(_connection)), rc};
@@ -179,7 +182,11 @@ inline void read_field(const bind_result_t& result,
 
   switch (result.get_type(index)) {
     case (SQLITE3_TEXT):
-      value = atof(reinterpret_cast<const char*>(result.get_text(index)));
+      ::sqlpp::detail::parse_number(
+          std::string_view(
+              reinterpret_cast<const char*>(result.get_text(index)),
+              static_cast<size_t>(result.get_bytes(index))),
+          value);
       break;
     default:
       value = result.get_double(index);
@@ -242,6 +249,12 @@ inline void read_field(const bind_result_t& result,
                        "Sqlite3 debug: binding date result at index {}", index);
   }
 
+  // Stored as integer, see chrono_storage::integer_epoch
+  if (result.get_type(index) == SQLITE_INTEGER) {
+    value = std::chrono::microseconds{result.get_int64(index)};
+    return;
+  }
+
   const char* time_string =
       reinterpret_cast<const char*>(result.get_text(index));
   if constexpr (debug_enabled) {
@@ -271,6 +284,12 @@ inline void read_field(const bind_result_t& result,
                        "Sqlite3 debug: binding date result at index {}", index);
   }
 
+  // Stored as integer, see chrono_storage::integer_epoch
+  if (result.get_type(index) == SQLITE_INTEGER) {
+    value = std::chrono::sys_days{std::chrono::days{result.get_int64(index)}};
+    return;
+  }
+
   const char* date_string =
       reinterpret_cast<const char*>(result.get_text(index));
   if constexpr (debug_enabled) {
@@ -300,6 +319,13 @@ inline void read_field(const bind_result_t& result,
                        "Sqlite3 debug: binding date result at index {}", index);
   }
 
+  // Stored as integer, see chrono_storage::integer_epoch
+  if (result.get_type(index) == SQLITE_INTEGER) {
+    value = ::sqlpp::chrono::sys_microseconds{
+        std::chrono::microseconds{result.get_int64(index)}};
+    return;
+  }
+
   const char* date_time_string =
       reinterpret_cast<const char*>(result.get_text(index));
   if constexpr (debug_enabled) {
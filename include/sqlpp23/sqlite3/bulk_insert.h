@@ -0,0 +1,121 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp23/core/type_traits/optional.h>
+#include <sqlpp23/sqlite3/database/exception.h>
+#include <sqlpp23/sqlite3/prepared_statement.h>
+
+namespace sqlpp::sqlite3::detail {
+// Binds a value of a bulk_insert row. Text and blobs are bound without copying
+// them if the rows outlive the execution of the statement, see
+// `destructor`.
+template <typename Value, typename Arg>
+void bind_bulk_value(prepared_statement_t& statement,
+                     size_t parameter_index,
+                     const Arg& arg,
+                     sqlite3_destructor_type destructor) {
+  if constexpr (is_optional<Value>::value) {
+    if constexpr (std::is_same_v<Arg, std::nullopt_t>) {
+      statement.bind_null(parameter_index);
+    } else if constexpr (is_optional<Arg>::value) {
+      if (arg.has_value()) {
+        bind_bulk_value<typename Value::value_type>(statement, parameter_index,
+                                                    *arg, destructor);
+      } else {
+        statement.bind_null(parameter_index);
+      }
+    } else {
+      bind_bulk_value<typename Value::value_type>(statement, parameter_index,
+                                                  arg, destructor);
+    }
+  } else if constexpr (std::is_same_v<Value, std::string>) {
+    const auto text = std::string_view{arg};
+    // A nullptr would be bound as NULL.
+    const int rc = sqlite3_bind_text(
+        statement.native_handle(), static_cast<int>(parameter_index + 1),
+        text.data() ? text.data() : "", static_cast<int>(text.size()),
+        destructor);
+    if (rc != SQLITE_OK) {
+      throw exception{
+          sqlite3_errmsg(sqlite3_db_handle(statement.native_handle())), rc};
+    }
+  } else if constexpr (std::is_same_v<Value, std::vector<uint8_t>>) {
+    const auto bytes = std::span<const uint8_t>{arg};
+    // A nullptr would be bound as NULL.
+    const int rc =
+        bytes.empty()
+            ? sqlite3_bind_zeroblob(statement.native_handle(),
+                                    static_cast<int>(parameter_index + 1), 0)
+            : sqlite3_bind_blob(statement.native_handle(),
+                                static_cast<int>(parameter_index + 1),
+                                bytes.data(), static_cast<int>(bytes.size()),
+                                destructor);
+    if (rc != SQLITE_OK) {
+      throw exception{
+          sqlite3_errmsg(sqlite3_db_handle(statement.native_handle())), rc};
+    }
+  } else {
+    bind_parameter(statement, parameter_index, static_cast<Value>(arg));
+  }
+}
+
+// Binds the values of `row` to the parameters starting at `parameter_index`.
+template <typename... Values, typename Row, size_t... Is>
+void bind_bulk_row(prepared_statement_t& statement,
+                   size_t parameter_index,
+                   const Row& row,
+                   sqlite3_destructor_type destructor,
+                   std::index_sequence<Is...>) {
+  static_assert(std::tuple_size_v<Row> == sizeof...(Values),
+                "Sqlite3: number of values in row does not match the number "
+                "of columns passed to bulk_insert");
+  using std::get;
+  (bind_bulk_value<std::tuple_element_t<Is, std::tuple<Values...>>>(
+       statement, parameter_index + Is, get<Is>(row), destructor),
+   ...);
+}
+}  // namespace sqlpp::sqlite3::detail
@@ -0,0 +1,126 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <sqlpp23/core/database/parameter_list.h>
+#include <sqlpp23/core/detail/type_vector.h>
+#include <sqlpp23/core/operator/enable_as.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/sqlite3/database/carray_module.h>
+#include <sqlpp23/sqlite3/prepared_statement.h>
+
+namespace sqlpp::sqlite3 {
+template <typename Value>
+concept carray_value = std::is_same_v<Value, int64_t> or
+                       std::is_same_v<Value, double> or
+                       std::is_same_v<Value, std::string_view> or
+                       std::is_same_v<Value, std::string>;
+
+// Parameter that binds a whole array of values, to be used with `in` and
+// `not_in` only (it is not a table expression), e.g.
+//
+//   tab.id.in(carray_parameter<int64_t>(ids))
+//
+// The value of the parameter is a std::span<const Value>. The array is not
+// copied and needs to outlive the execution of the statement.
+template <typename Value, typename NameTag>
+struct carray_parameter_t : public enable_as {
+  using _instance_t =
+      typename NameTag::template _member_t<std::span<const Value>>;
+  carray_parameter_t() = default;
+
+  carray_parameter_t(const carray_parameter_t&) = default;
+  carray_parameter_t(carray_parameter_t&&) = default;
+  carray_parameter_t& operator=(const carray_parameter_t&) = default;
+  carray_parameter_t& operator=(carray_parameter_t&&) = default;
+  ~carray_parameter_t() = default;
+};
+
+template <typename Context, typename Value, typename NameTag>
+auto to_sql_string(Context& context,
+                   const carray_parameter_t<Value, NameTag>&) -> std::string {
+  record_parameter<carray_parameter_t<Value, NameTag>>(context._parameters);
+  return std::string{"SELECT value FROM "} + detail::carray_name + "(?)";
+}
+
+template <carray_value Value, typename NameTagProvider>
+  requires(has_name_tag<NameTagProvider>::value)
+auto carray_parameter(const NameTagProvider& /*unused*/)
+    -> carray_parameter_t<Value, name_tag_of_t<NameTagProvider>> {
+  return {};
+}
+
+template <carray_value Value>
+void bind_parameter(prepared_statement_t& statement,
+                    size_t parameter_index,
+                    const std::span<const Value>& values) {
+  if constexpr (debug_enabled) {
+    statement.debug().log(log_category::parameter,
+                          "Sqlite3 debug: binding array of {} values at "
+                          "parameter_index {}",
+                          values.size(), parameter_index);
+  }
+  constexpr auto type =
+      std::is_same_v<Value, int64_t>            ? detail::carray_type::int64
+      : std::is_same_v<Value, double>           ? detail::carray_type::real
+      : std::is_same_v<Value, std::string_view> ? detail::carray_type::text_view
+                                                : detail::carray_type::text;
+  const int rc = sqlite3_bind_pointer(
+      statement.native_handle(), static_cast<int>(parameter_index + 1),
+      new detail::carray_data{values.data(), values.size(), type},
+      detail::carray_name,
+      [](void* data) { delete static_cast<detail::carray_data*>(data); });
+  if (rc != SQLITE_OK) {
+    throw exception{
+        sqlite3_errmsg(sqlite3_db_handle(statement.native_handle())), rc};
+  }
+}
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp {
+template <typename Value, typename NameTag>
+struct parameters_of<sqlite3::carray_parameter_t<Value, NameTag>> {
+  using type = detail::type_vector<sqlite3::carray_parameter_t<Value, NameTag>>;
+};
+
+template <typename Value, typename NameTag>
+struct data_type_of<sqlite3::carray_parameter_t<Value, NameTag>> {
+  using type = data_type_of_t<Value>;
+};
+
+// Like a sub select, the parameter needs parentheses unless used with `in`.
+template <typename Value, typename NameTag>
+struct requires_parentheses<sqlite3::carray_parameter_t<Value, NameTag>>
+    : public std::true_type {};
+}  // namespace sqlpp
@@ -76,6 +76,10 @@ template <typename InsertOrAlternative>
 struct is_result_clause<sqlite3::insert_or_t<InsertOrAlternative>>
     : public std::true_type {};
 
+template <typename InsertOrAlternative>
+struct has_static_sql<sqlite3::insert_or_t<InsertOrAlternative>>
+    : public std::true_type {};
+
 template <typename InsertOrAlternative>
 struct result_methods_of<sqlite3::insert_or_t<InsertOrAlternative>> {
   using type = sqlite3::insert_or_result_methods_t;
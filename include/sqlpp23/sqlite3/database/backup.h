@@ -0,0 +1,147 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <string>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp23/sqlite3/database/exception.h>
+
+namespace sqlpp::sqlite3 {
+struct backup_progress {
+  int remaining;   // pages still to be copied
+  int page_count;  // total number of pages of the source database
+};
+
+// Copies a database in steps using the online backup API, see
+// https://www.sqlite.org/backup.html
+// Between steps, the source database can be used (and modified) by other
+// connections.
+class backup_t {
+  // The other database, if opened by the backup. Declared first, so that it is
+  // closed after the backup has been finished.
+  std::unique_ptr<::sqlite3, int (*)(::sqlite3*)> _file;
+  std::unique_ptr<sqlite3_backup, int (*)(sqlite3_backup*)> _backup;
+  ::sqlite3* _destination;
+  bool _done = false;
+  bool _busy = false;
+
+ public:
+  // Copies the main database of `source` into the main database of
+  // `destination`. Takes ownership of `file`, which is either of them or
+  // nullptr.
+  backup_t(::sqlite3* destination, ::sqlite3* source, ::sqlite3* file)
+      : _file{file, sqlite3_close},
+        _backup{nullptr, sqlite3_backup_finish},
+        _destination{destination} {
+    _backup.reset(sqlite3_backup_init(destination, "main", source, "main"));
+    if (not _backup) {
+      throw exception{sqlite3_errmsg(destination),
+                      sqlite3_errcode(destination)};
+    }
+  }
+
+  backup_t(const backup_t&) = delete;
+  backup_t(backup_t&&) = default;
+  backup_t& operator=(const backup_t&) = delete;
+  // The other database must be closed after the backup is finished.
+  backup_t& operator=(backup_t&&) = delete;
+  ~backup_t() = default;
+
+  // Copies up to `pages` pages (all remaining pages if negative). Returns true
+  // once the backup is complete. If a database is locked by another
+  // connection, no pages are copied and `busy()` returns true; try again
+  // later.
+  bool step(int pages) {
+    if (_done) {
+      return true;
+    }
+    const auto rc = sqlite3_backup_step(_backup.get(), pages);
+    _busy = false;
+    switch (rc) {
+      case SQLITE_DONE:
+        _done = true;
+        return true;
+      case SQLITE_OK:
+        return false;
+      case SQLITE_BUSY:
+      case SQLITE_LOCKED:
+        _busy = true;
+        return false;
+      default:
+        throw exception{sqlite3_errstr(rc), rc};
+    }
+  }
+
+  bool done() const { return _done; }
+  bool busy() const { return _busy; }
+
+  // Progress as of the last step.
+  backup_progress progress() const {
+    return {sqlite3_backup_remaining(_backup.get()),
+            sqlite3_backup_pagecount(_backup.get())};
+  }
+
+  // Runs all steps, reporting the progress after each step. Waits a little if
+  // a database is busy.
+  template <typename Progress>
+  void run(int pages_per_step, Progress&& on_progress) {
+    while (not step(pages_per_step)) {
+      on_progress(progress());
+      if (_busy) {
+        sqlite3_sleep(10);
+      }
+    }
+    on_progress(progress());
+  }
+};
+
+namespace detail {
+struct ignore_progress {
+  void operator()(const backup_progress&) const {}
+};
+
+inline ::sqlite3* open_database(const std::string& path, int flags) {
+  ::sqlite3* file = nullptr;
+  const auto rc = sqlite3_open_v2(path.c_str(), &file, flags, nullptr);
+  if (rc != SQLITE_OK) {
+    const auto message = std::string{sqlite3_errmsg(file)};
+    sqlite3_close(file);
+    throw exception{message, rc};
+  }
+  return file;
+}
+}  // namespace detail
+}  // namespace sqlpp::sqlite3
@@ -0,0 +1,162 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp23/core/operator/enable_as.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/sqlite3/database/exception.h>
+
+namespace sqlpp::sqlite3 {
+enum class blob_mode { read_only, read_write };
+
+// Incremental I/O on a single blob, see https://www.sqlite.org/c3ref/blob.html
+// Blobs are read and written in chunks, without loading the whole value into
+// memory. Writing cannot change the size of the blob, see `zeroblob` for
+// reserving space.
+//
+// A blob handle is invalidated ("expired") if the row is modified or deleted
+// by other statements. Use `reopen` to move the handle to another row of the
+// same column, which is faster than opening a new handle.
+class blob_handle {
+  std::unique_ptr<sqlite3_blob, int (*)(sqlite3_blob*)> _blob;
+  ::sqlite3* _connection;
+
+ public:
+  blob_handle(::sqlite3* connection,
+              const char* database,
+              const char* table,
+              const char* column,
+              int64_t rowid,
+              blob_mode mode)
+      : _blob{nullptr, sqlite3_blob_close}, _connection{connection} {
+    sqlite3_blob* blob = nullptr;
+    const auto rc =
+        sqlite3_blob_open(connection, database, table, column, rowid,
+                          mode == blob_mode::read_write ? 1 : 0, &blob);
+    _blob.reset(blob);
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(connection), rc};
+    }
+  }
+
+  blob_handle(const blob_handle&) = delete;
+  blob_handle(blob_handle&&) = default;
+  blob_handle& operator=(const blob_handle&) = delete;
+  blob_handle& operator=(blob_handle&&) = default;
+  ~blob_handle() = default;
+
+  ::sqlite3_blob* native_handle() const { return _blob.get(); }
+
+  // Size of the blob in bytes.
+  size_t size() const {
+    return static_cast<size_t>(sqlite3_blob_bytes(_blob.get()));
+  }
+
+  // Reads `buffer.size()` bytes, starting at `offset`. Throws if the blob has
+  // fewer bytes.
+  void read(std::span<uint8_t> buffer, size_t offset = 0) const {
+    check_range(buffer.size(), offset);
+    const auto rc =
+        sqlite3_blob_read(_blob.get(), buffer.data(),
+                          static_cast<int>(buffer.size()),
+                          static_cast<int>(offset));
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(_connection), rc};
+    }
+  }
+
+  // Writes `data`, starting at `offset`. Throws if the blob is too small.
+  void write(std::span<const uint8_t> data, size_t offset = 0) {
+    check_range(data.size(), offset);
+    const auto rc = sqlite3_blob_write(_blob.get(), data.data(),
+                                       static_cast<int>(data.size()),
+                                       static_cast<int>(offset));
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(_connection), rc};
+    }
+  }
+
+  // Points the handle to the same column of another row.
+  void reopen(int64_t rowid) {
+    const auto rc = sqlite3_blob_reopen(_blob.get(), rowid);
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(_connection), rc};
+    }
+  }
+
+ private:
+  void check_range(size_t length, size_t offset) const {
+    if (offset > size() or length > size() - offset) {
+      throw exception{"Sqlite3 error: blob access out of range", SQLITE_ERROR};
+    }
+  }
+};
+
+// Blob of `size` zero bytes, e.g. to reserve space for incremental writing,
+// see https://www.sqlite.org/c3ref/blob_open.html
+struct zeroblob_t : public enable_as {
+  zeroblob_t(int64_t size) : _size{size} {}
+
+  zeroblob_t(const zeroblob_t&) = default;
+  zeroblob_t(zeroblob_t&&) = default;
+  zeroblob_t& operator=(const zeroblob_t&) = default;
+  zeroblob_t& operator=(zeroblob_t&&) = default;
+  ~zeroblob_t() = default;
+
+  int64_t _size;
+};
+
+template <typename Context>
+auto to_sql_string(Context&, const zeroblob_t& t) -> std::string {
+  return "zeroblob(" + std::to_string(t._size) + ")";
+}
+
+inline auto zeroblob(int64_t size) -> zeroblob_t {
+  return {size};
+}
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp {
+template <>
+struct data_type_of<sqlite3::zeroblob_t> {
+  using type = blob;
+};
+}  // namespace sqlpp
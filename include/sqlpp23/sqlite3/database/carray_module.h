@@ -0,0 +1,212 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3::detail {
+// Eponymous virtual table that returns the elements of an array bound as
+// pointer, similar to https://www.sqlite.org/carray.html, e.g.
+//
+//   SELECT value FROM sqlpp_carray(?)
+//
+// The array needs to outlive the execution of the statement.
+inline constexpr const char carray_name[] = "sqlpp_carray";
+
+enum class carray_type { int64, real, text_view, text };
+
+struct carray_data {
+  const void* values;
+  size_t size;
+  carray_type type;
+};
+
+struct carray_cursor : public sqlite3_vtab_cursor {
+  const carray_data* data;
+  size_t row;
+};
+
+inline int carray_connect(::sqlite3* db,
+                          void* /*aux*/,
+                          int /*argc*/,
+                          const char* const* /*argv*/,
+                          sqlite3_vtab** vtab,
+                          char** /*error*/) {
+  const auto rc =
+      sqlite3_declare_vtab(db, "CREATE TABLE x(value, pointer HIDDEN)");
+  if (rc != SQLITE_OK) {
+    return rc;
+  }
+  *vtab = new sqlite3_vtab{};
+  sqlite3_vtab_config(db, SQLITE_VTAB_INNOCUOUS);
+  return SQLITE_OK;
+}
+
+inline int carray_disconnect(sqlite3_vtab* vtab) {
+  delete vtab;
+  return SQLITE_OK;
+}
+
+inline int carray_open(sqlite3_vtab* /*vtab*/, sqlite3_vtab_cursor** cursor) {
+  *cursor = new carray_cursor{};
+  return SQLITE_OK;
+}
+
+inline int carray_close(sqlite3_vtab_cursor* cursor) {
+  delete static_cast<carray_cursor*>(cursor);
+  return SQLITE_OK;
+}
+
+// idx_num is 1 if the array is passed as argument, 0 otherwise (empty).
+inline int carray_best_index(sqlite3_vtab* /*vtab*/,
+                             sqlite3_index_info* info) {
+  constexpr int pointer_column = 1;
+  bool unusable = false;
+  for (int i = 0; i < info->nConstraint; ++i) {
+    const auto& constraint = info->aConstraint[i];
+    if (constraint.iColumn != pointer_column or
+        constraint.op != SQLITE_INDEX_CONSTRAINT_EQ) {
+      continue;
+    }
+    if (not constraint.usable) {
+      unusable = true;
+      continue;
+    }
+    info->aConstraintUsage[i].argvIndex = 1;
+    info->aConstraintUsage[i].omit = 1;
+    info->idxNum = 1;
+    info->estimatedCost = 1;
+    info->estimatedRows = 100;
+    return SQLITE_OK;
+  }
+  if (unusable) {
+    // Ask for a plan in which the argument is available.
+    return SQLITE_CONSTRAINT;
+  }
+  info->idxNum = 0;
+  info->estimatedCost = 2147483647;
+  info->estimatedRows = 1;
+  return SQLITE_OK;
+}
+
+inline int carray_filter(sqlite3_vtab_cursor* cursor,
+                         int idx_num,
+                         const char* /*idx_str*/,
+                         int /*argc*/,
+                         sqlite3_value** argv) {
+  auto& carray = *static_cast<carray_cursor*>(cursor);
+  carray.data =
+      idx_num == 1 ? static_cast<const carray_data*>(
+                         sqlite3_value_pointer(argv[0], carray_name))
+                   : nullptr;
+  carray.row = 0;
+  return SQLITE_OK;
+}
+
+inline int carray_next(sqlite3_vtab_cursor* cursor) {
+  ++static_cast<carray_cursor*>(cursor)->row;
+  return SQLITE_OK;
+}
+
+inline int carray_eof(sqlite3_vtab_cursor* cursor) {
+  const auto& carray = *static_cast<carray_cursor*>(cursor);
+  return not carray.data or carray.row >= carray.data->size;
+}
+
+inline int carray_column(sqlite3_vtab_cursor* cursor,
+                         sqlite3_context* context,
+                         int column) {
+  const auto& carray = *static_cast<carray_cursor*>(cursor);
+  if (column != 0) {
+    sqlite3_result_null(context);
+    return SQLITE_OK;
+  }
+  const auto row = carray.row;
+  switch (carray.data->type) {
+    case carray_type::int64:
+      sqlite3_result_int64(
+          context, static_cast<const int64_t*>(carray.data->values)[row]);
+      break;
+    case carray_type::real:
+      sqlite3_result_double(
+          context, static_cast<const double*>(carray.data->values)[row]);
+      break;
+    case carray_type::text_view: {
+      const auto& text =
+          static_cast<const std::string_view*>(carray.data->values)[row];
+      // SQLite turns a null pointer into NULL, e.g. for std::string_view{}.
+      sqlite3_result_text(context, text.data() ? text.data() : "",
+                          static_cast<int>(text.size()), SQLITE_STATIC);
+      break;
+    }
+    case carray_type::text: {
+      const auto& text =
+          static_cast<const std::string*>(carray.data->values)[row];
+      sqlite3_result_text(context, text.data(), static_cast<int>(text.size()),
+                          SQLITE_STATIC);
+      break;
+    }
+  }
+  return SQLITE_OK;
+}
+
+inline int carray_rowid(sqlite3_vtab_cursor* cursor, sqlite3_int64* rowid) {
+  *rowid =
+      static_cast<sqlite3_int64>(static_cast<carray_cursor*>(cursor)->row + 1);
+  return SQLITE_OK;
+}
+
+// Eponymous-only (no xCreate) and read-only.
+inline const sqlite3_module* carray_module() {
+  static const sqlite3_module module = [] {
+    auto m = sqlite3_module{};
+    m.xConnect = carray_connect;
+    m.xBestIndex = carray_best_index;
+    m.xDisconnect = carray_disconnect;
+    m.xOpen = carray_open;
+    m.xClose = carray_close;
+    m.xFilter = carray_filter;
+    m.xNext = carray_next;
+    m.xEof = carray_eof;
+    m.xColumn = carray_column;
+    m.xRowid = carray_rowid;
+    return m;
+  }();
+  return &module;
+}
+}  // namespace sqlpp::sqlite3::detail
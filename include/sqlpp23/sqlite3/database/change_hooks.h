@@ -0,0 +1,132 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp::sqlite3 {
+enum class change_operation { insert, update, delete_from };
+
+// A row that was inserted, updated, or deleted, see
+// https://www.sqlite.org/c3ref/update_hook.html
+struct row_change {
+  change_operation operation;
+  std::string_view database;  // "main", "temp", or an attached schema
+  std::string_view table;
+  int64_t rowid;
+
+  // Whether the change affects the given table, e.g. `change.is(tab)`.
+  template <typename Table>
+    requires(sqlpp::is_raw_table_v<Table>)
+  bool is(const Table&) const {
+    constexpr auto name = std::string_view{name_tag_of_t<Table>::name};
+    return table.size() == name.size() and
+           sqlite3_strnicmp(table.data(), name.data(),
+                            static_cast<int>(name.size())) == 0;
+  }
+};
+
+namespace detail {
+// Registered with SQLite once per connection. Hooks are called by the thread
+// executing the statement and must neither throw nor use the connection.
+struct change_hooks {
+  struct table_hook {
+    std::string table;
+    std::function<void(change_operation, int64_t)> callback;
+  };
+
+  std::function<void(const row_change&)> on_change;
+  std::vector<table_hook> table_hooks;
+  std::function<void()> on_commit;
+  std::function<void()> on_rollback;
+
+  static void update(void* self,
+                     int op,
+                     const char* database,
+                     const char* table,
+                     sqlite3_int64 rowid) noexcept {
+    const auto& hooks = *static_cast<const change_hooks*>(self);
+    const auto change = row_change{
+        .operation = op == SQLITE_INSERT   ? change_operation::insert
+                     : op == SQLITE_UPDATE ? change_operation::update
+                                           : change_operation::delete_from,
+        .database = database,
+        .table = table,
+        .rowid = rowid};
+    if (hooks.on_change) {
+      hooks.on_change(change);
+    }
+    for (const auto& hook : hooks.table_hooks) {
+      if (sqlite3_stricmp(hook.table.c_str(), table) == 0) {
+        hook.callback(change.operation, change.rowid);
+      }
+    }
+  }
+
+  static int commit(void* self) noexcept {
+    const auto& hooks = *static_cast<const change_hooks*>(self);
+    if (hooks.on_commit) {
+      hooks.on_commit();
+    }
+    return 0;  // Non-zero would turn the commit into a rollback.
+  }
+
+  static void rollback(void* self) noexcept {
+    const auto& hooks = *static_cast<const change_hooks*>(self);
+    if (hooks.on_rollback) {
+      hooks.on_rollback();
+    }
+  }
+
+  void register_with(::sqlite3* connection) {
+    sqlite3_update_hook(connection, &update, this);
+    sqlite3_commit_hook(connection, &commit, this);
+    sqlite3_rollback_hook(connection, &rollback, this);
+  }
+
+  static void unregister_from(::sqlite3* connection) {
+    sqlite3_update_hook(connection, nullptr, nullptr);
+    sqlite3_commit_hook(connection, nullptr, nullptr);
+    sqlite3_rollback_hook(connection, nullptr, nullptr);
+  }
+};
+}  // namespace detail
+}  // namespace sqlpp::sqlite3
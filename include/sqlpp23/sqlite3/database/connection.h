@@ -28,7 +28,14 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ranges>
 #include <string>
+#include <tuple>
+#include <type_traits>
 
 #ifdef SQLPP_USE_SQLCIPHER
 #include <sqlcipher/sqlite3.h>
@@ -37,18 +44,25 @@
 #endif
 #include <sqlpp23/core/basic/schema.h>
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/database/parameter_list.h>
 #include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/query/static_sql.h>
 #include <sqlpp23/core/query/statement_handler.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/core/type_traits.h>
 #include <sqlpp23/sqlite3/bind_result.h>
+#include <sqlpp23/sqlite3/bulk_insert.h>
 #include <sqlpp23/sqlite3/constraints.h>
+#include <sqlpp23/sqlite3/database/backup.h>
+#include <sqlpp23/sqlite3/database/blob_handle.h>
+#include <sqlpp23/sqlite3/database/change_hooks.h>
 #include <sqlpp23/sqlite3/database/connection_config.h>
 #include <sqlpp23/sqlite3/database/connection_handle.h>
 #include <sqlpp23/sqlite3/database/exception.h>
 #include <sqlpp23/sqlite3/database/serializer_context.h>
 #include <sqlpp23/sqlite3/prepared_statement.h>
 #include <sqlpp23/sqlite3/to_sql_string.h>
+#include <sqlpp23/sqlite3/user_function.h>
 
 namespace sqlpp::sqlite3 {
 
@@ -64,7 +78,10 @@ inline void execute_statement(connection_handle& handle,
   switch (rc) {
     case SQLITE_OK:
     case SQLITE_ROW:  // might occur if execute is called with a select
+      return;
     case SQLITE_DONE:
+      report_statement_status(handle.config->statement_status_callback,
+                              prepared.native_handle());
       return;
     default:
       if constexpr (debug_enabled) {
@@ -94,30 +111,93 @@ class connection_base : public sqlpp::connection {
   using _handle_t = detail::connection_handle;
 
   using _prepared_statement_t = prepared_statement_t;
+  using _context_t = context_t;
+  using _literals_t = std::vector<detail::literal_parameter>;
 
  private:
   friend sqlpp::statement_handler_t;
 
   bool _transaction_active{false};
 
+  // Hooks are registered with SQLite when first used.
+  detail::change_hooks& _change_hooks() {
+    if (not _handle.hooks) {
+      _handle.hooks = std::make_unique<detail::change_hooks>();
+      _handle.hooks->register_with(native_handle());
+    }
+    return *_handle.hooks;
+  }
+
+  // Direct execution uses the statement cache, if enabled.
+  prepared_statement_t prepare_cached(std::string_view statement) {
+    if (_handle.statements.capacity() == 0) {
+      return prepare_statement(_handle, statement);
+    }
+    if (auto cached = _handle.statements.acquire(statement)) {
+      if constexpr (debug_enabled) {
+        _handle.debug().log(log_category::statement, "Using cached: '{}'",
+                            statement);
+      }
+      return prepared_statement_t{native_handle(), std::move(cached),
+                                  _handle.config.get()};
+    }
+    // Cached statements are expected to be around for a while.
+    auto prepared = prepared_statement_t{native_handle(), statement,
+                                         _handle.config.get(),
+                                         SQLITE_PREPARE_PERSISTENT};
+    return prepared_statement_t{
+        native_handle(),
+        _handle.statements.insert(statement,
+                                  std::move(prepared._sqlite3_statement)),
+        _handle.config.get()};
+  }
+
+  // Literals are replaced by parameters if enabled, see
+  // connection_config::auto_parameterize.
+  void collect_literals(context_t& context,
+                        std::vector<detail::literal_parameter>& literals) {
+    if (_handle.config->auto_parameterize) {
+      _collect_literals(context, literals);
+    }
+  }
+
+  // Binds the literals that were replaced by parameters during serialization,
+  // see connection_config::auto_parameterize.
+  static void bind_literals(
+      prepared_statement_t& prepared,
+      const std::vector<detail::literal_parameter>& literals) {
+    for (size_t i = 0; i < literals.size(); ++i) {
+      prepared.bind_literal(i, literals[i]);
+    }
+  }
+
   // direct execution
-  command_result execute_impl(std::string_view statement) {
-    auto prepared = prepare_statement(_handle, statement);
+  command_result execute_impl(
+      std::string_view statement,
+      const std::vector<detail::literal_parameter>& literals = {}) {
+    auto prepared = prepare_cached(statement);
+    bind_literals(prepared, literals);
     execute_statement(_handle, prepared);
 
     return {.affected_rows =
                 static_cast<uint64_t>(sqlite3_changes(native_handle()))};
   }
 
-  bind_result_t select_impl(const std::string& statement) {
-    auto prepared = prepare_statement(_handle, statement);
+  bind_result_t select_impl(
+      const std::string& statement,
+      const std::vector<detail::literal_parameter>& literals) {
+    auto prepared = prepare_cached(statement);
+    bind_literals(prepared, literals);
 
     return {native_handle(), prepared._sqlite3_statement,
             _handle.config.get()};
   }
 
-  insert_result insert_impl(const std::string& statement) {
-    auto prepared = prepare_statement(_handle, statement);
+  insert_result insert_impl(
+      const std::string& statement,
+      const std::vector<detail::literal_parameter>& literals) {
+    auto prepared = prepare_cached(statement);
+    bind_literals(prepared, literals);
     execute_statement(_handle, prepared);
 
     return {
@@ -126,23 +206,32 @@ class connection_base : public sqlpp::connection {
             static_cast<uint64_t>(sqlite3_last_insert_rowid(native_handle()))};
   }
 
-  command_result update_impl(const std::string& statement) {
-    auto prepared = prepare_statement(_handle, statement);
+  command_result update_impl(
+      const std::string& statement,
+      const std::vector<detail::literal_parameter>& literals) {
+    auto prepared = prepare_cached(statement);
+    bind_literals(prepared, literals);
     execute_statement(_handle, prepared);
     return {.affected_rows =
                 static_cast<uint64_t>(sqlite3_changes(native_handle()))};
   }
 
-  command_result delete_from_impl(const std::string& statement) {
-    auto prepared = prepare_statement(_handle, statement);
+  command_result delete_from_impl(
+      const std::string& statement,
+      const std::vector<detail::literal_parameter>& literals) {
+    auto prepared = prepare_cached(statement);
+    bind_literals(prepared, literals);
     execute_statement(_handle, prepared);
     return {.affected_rows =
                 static_cast<uint64_t>(sqlite3_changes(native_handle()))};
   }
 
   // prepared execution
-  prepared_statement_t prepare_impl(const std::string& statement) {
-    return prepare_statement(_handle, statement);
+  prepared_statement_t prepare_impl(const std::string& statement,
+                                    parameter_positions_t active) {
+    auto prepared = prepare_statement(_handle, statement);
+    prepared._active_parameters = std::move(active);
+    return prepared;
   }
 
   bind_result_t run_prepared_select_impl(
@@ -189,15 +278,20 @@ class connection_base : public sqlpp::connection {
   template <typename Select>
   bind_result_t _select(const Select& s) {
     context_t context{this};
-    auto query = to_sql_string(context, s);
-    return select_impl(query);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return select_impl(query, literals);
   }
 
   template <typename Select>
   _prepared_statement_t _prepare_select(const Select& s) {
     context_t context{this};
-    auto query = to_sql_string(context, s);
-    return prepare_impl(query);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, s, buffer);
+    return prepare_impl(query,
+                        active_parameters<Select>(context._parameters));
   }
 
   template <typename PreparedSelect>
@@ -212,15 +306,20 @@ class connection_base : public sqlpp::connection {
   template <typename Insert>
   insert_result _insert(const Insert& i) {
     context_t context{this};
-    auto query = to_sql_string(context, i);
-    return insert_impl(query);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, i, buffer);
+    return insert_impl(query, literals);
   }
 
   template <typename Insert>
   _prepared_statement_t _prepare_insert(const Insert& i) {
     context_t context{this};
-    auto query = to_sql_string(context, i);
-    return prepare_impl(query);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, i, buffer);
+    return prepare_impl(query,
+                        active_parameters<Insert>(context._parameters));
   }
 
   template <typename PreparedInsert>
@@ -235,15 +334,20 @@ class connection_base : public sqlpp::connection {
   template <typename Update>
   command_result _update(const Update& u) {
     context_t context{this};
-    auto query = to_sql_string(context, u);
-    return update_impl(query);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, u, buffer);
+    return update_impl(query, literals);
   }
 
   template <typename Update>
   _prepared_statement_t _prepare_update(const Update& u) {
     context_t context{this};
-    auto query = to_sql_string(context, u);
-    return prepare_impl(query);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, u, buffer);
+    return prepare_impl(query,
+                        active_parameters<Update>(context._parameters));
   }
 
   template <typename PreparedUpdate>
@@ -258,15 +362,20 @@ class connection_base : public sqlpp::connection {
   template <typename Delete>
   command_result _delete_from(const Delete& r) {
     context_t context{this};
-    auto query = to_sql_string(context, r);
-    return delete_from_impl(query);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, r, buffer);
+    return delete_from_impl(query, literals);
   }
 
   template <typename Delete>
   _prepared_statement_t _prepare_delete_from(const Delete& r) {
     context_t context{this};
-    auto query = to_sql_string(context, r);
-    return prepare_impl(query);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, r, buffer);
+    return prepare_impl(query,
+                        active_parameters<Delete>(context._parameters));
   }
 
   template <typename PreparedDelete>
@@ -283,15 +392,20 @@ class connection_base : public sqlpp::connection {
   template <typename Execute>
   command_result _execute(const Execute& r) {
     context_t context{this};
-    auto query = to_sql_string(context, r);
-    return execute_impl(query);
+    auto literals = std::vector<detail::literal_parameter>{};
+    collect_literals(context, literals);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, r, buffer);
+    return execute_impl(query, literals);
   }
 
   template <typename Execute>
   _prepared_statement_t _prepare_execute(const Execute& x) {
     context_t context{this};
-    auto query = to_sql_string(context, x);
-    return prepare_impl(query);
+    auto buffer = std::string{};
+    const auto& query = statement_sql_string(context, x, buffer);
+    return prepare_impl(query,
+                        active_parameters<Execute>(context._parameters));
   }
 
   template <typename PreparedExecute>
@@ -327,6 +441,303 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! insert rows into the given columns of a table, using multi-row inserts
+  //! with as many rows per statement as the limit for the number of
+  //! parameters allows (see SQLITE_LIMIT_VARIABLE_NUMBER). The statement is
+  //! prepared once and re-used for all full chunks of rows; the remaining rows
+  //! are inserted with a second statement. Each row is a tuple with one value
+  //! per column. Unless a transaction is active, all rows are inserted in one
+  //! transaction.
+  template <typename Table, typename... Columns, typename Rows>
+    requires(sqlpp::is_raw_table_v<Table> and
+             (sqlpp::is_column_v<Columns> and ...) and
+             std::ranges::forward_range<const Rows>)
+  command_result bulk_insert(const Table& table,
+                             const std::tuple<Columns...>& /*columns*/,
+                             const Rows& rows) {
+    static_assert(sizeof...(Columns) > 0,
+                  "Sqlite3: bulk_insert requires at least one column");
+    static_assert((std::is_same_v<typename Columns::_table, Table> and ...),
+                  "Sqlite3: bulk_insert columns must belong to the table");
+    constexpr size_t column_count = sizeof...(Columns);
+
+    const auto max_parameters = static_cast<size_t>(
+        sqlite3_limit(native_handle(), SQLITE_LIMIT_VARIABLE_NUMBER, -1));
+    auto rows_per_statement = max_parameters / column_count;
+    if (rows_per_statement == 0) {
+      throw sqlpp::exception{
+          "Sqlite3: bulk_insert has more columns than parameters are allowed"};
+    }
+    if constexpr (std::ranges::sized_range<const Rows>) {
+      rows_per_statement = std::min(
+          rows_per_statement, static_cast<size_t>(std::ranges::size(rows)));
+    }
+
+    context_t context{this};
+    auto prefix = "INSERT INTO " + to_sql_string(context, table) + " (";
+    auto separator = std::string_view{};
+    ((prefix += separator,
+      prefix += sqlpp::name_to_sql_string(context, name_tag_of_t<Columns>{}),
+      separator = ", "),
+     ...);
+    prefix += ") VALUES ";
+    auto placeholders = std::string{"("};
+    for (size_t i = 0; i < column_count; ++i) {
+      placeholders += i ? ",?" : "?";
+    }
+    placeholders += ")";
+    const auto prepare_insert = [&](size_t row_count) {
+      auto query = prefix;
+      query.reserve(prefix.size() + row_count * (placeholders.size() + 1));
+      for (size_t i = 0; i < row_count; ++i) {
+        if (i) {
+          query += ',';
+        }
+        query += placeholders;
+      }
+      return prepared_statement_t{native_handle(), query, _handle.config.get(),
+                                  SQLITE_PREPARE_PERSISTENT};
+    };
+
+    // Text and blobs can only be bound without copying if the rows outlive
+    // the execution of the statement.
+    const auto destructor =
+        std::is_reference_v<std::ranges::range_reference_t<const Rows>>
+            ? SQLITE_STATIC
+            : SQLITE_TRANSIENT;
+    const auto bind_row = [&](prepared_statement_t& prepared, size_t row_index,
+                              const auto& row) {
+      detail::bind_bulk_row<parameter_value_t<data_type_of_t<Columns>>...>(
+          prepared, row_index * column_count, row, destructor,
+          std::index_sequence_for<Columns...>{});
+    };
+    auto affected_rows = uint64_t{0};
+    const auto execute = [&](prepared_statement_t& prepared) {
+      execute_statement(_handle, prepared);
+      affected_rows += static_cast<uint64_t>(sqlite3_changes(native_handle()));
+      prepared._reset();
+    };
+
+    const bool own_transaction = sqlite3_get_autocommit(native_handle());
+    if (own_transaction) {
+      start_transaction();
+    }
+    try {
+      auto full_chunk = std::optional<prepared_statement_t>{};
+      auto it = std::ranges::begin(rows);
+      const auto end = std::ranges::end(rows);
+      while (it != end) {
+        // Determine the size of the chunk first, so that each row is bound
+        // only once.
+        using difference_t = std::ranges::range_difference_t<const Rows>;
+        auto chunk_end = it;
+        const auto row_count =
+            rows_per_statement -
+            static_cast<size_t>(std::ranges::advance(
+                chunk_end, static_cast<difference_t>(rows_per_statement), end));
+        auto tail = std::optional<prepared_statement_t>{};
+        if (row_count == rows_per_statement) {
+          if (not full_chunk) {
+            full_chunk.emplace(prepare_insert(rows_per_statement));
+          }
+        } else {
+          tail.emplace(prepare_insert(row_count));
+        }
+        auto& prepared = tail ? *tail : *full_chunk;
+        for (size_t i = 0; i < row_count; ++i, ++it) {
+          bind_row(prepared, i, *it);
+        }
+        execute(prepared);
+      }
+    } catch (...) {
+      if (own_transaction) {
+        rollback_transaction();
+      }
+      throw;
+    }
+    if (own_transaction) {
+      commit_transaction();
+    }
+    return {.affected_rows = affected_rows};
+  }
+
+  //! register a C++ callable as scalar SQL function, see
+  //! https://www.sqlite.org/c3ref/create_function.html
+  //! The SQL name of the function is taken from the name tag. Parameter and
+  //! result types are deduced from the callable (which must not be generic).
+  //! Arguments that are NULL yield NULL, unless the parameter is optional.
+  //! `flags` are added to SQLITE_UTF8, e.g. SQLITE_DETERMINISTIC.
+  //! Returns a typed handle for calling the function in expressions.
+  template <typename NameTag, typename Callable>
+    requires(sqlpp::has_name_tag_v<NameTag>)
+  auto create_function(const NameTag& /*name*/,
+                       Callable callable,
+                       int flags = 0) {
+    using _signature = detail::callable_signature<Callable>;
+    const auto rc = sqlite3_create_function_v2(
+        native_handle(), name_tag_of_t<NameTag>::name,
+        static_cast<int>(
+            std::tuple_size_v<typename _signature::parameters>),
+        SQLITE_UTF8 | flags, new Callable{std::move(callable)},
+        &detail::scalar_function_callback<Callable>, nullptr, nullptr,
+        // Also called by SQLite if the registration fails.
+        [](void* data) { delete static_cast<Callable*>(data); });
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(native_handle()), rc};
+    }
+    return typename _signature::template handle_t<user_function_t, NameTag>{};
+  }
+
+  //! register a C++ class as aggregate SQL function, see
+  //! https://www.sqlite.org/c3ref/create_function.html
+  //! The class needs to be default constructible and have member functions
+  //! `step(...)`, which is called for each row, and `finalize()`, which
+  //! returns the result. If the class also has `inverse(...)` and `value()`,
+  //! it can be used as window function. Parameter and result types are
+  //! deduced from `step` and `finalize`. Rows with NULL arguments are ignored,
+  //! unless the parameter is optional.
+  //! `flags` are added to SQLITE_UTF8, e.g. SQLITE_DETERMINISTIC.
+  //! Returns a typed handle for calling the function in expressions.
+  template <typename Aggregate, typename NameTag>
+    requires(sqlpp::has_name_tag_v<NameTag> and
+             std::is_default_constructible_v<Aggregate>)
+  auto create_aggregate(const NameTag& /*name*/, int flags = 0) {
+    using _callbacks = detail::aggregate_callbacks<Aggregate>;
+    using _signature =
+        detail::callable_signature<decltype(&Aggregate::step)>;
+    using _result_t = decltype(std::declval<Aggregate&>().finalize());
+    const auto argument_count = static_cast<int>(
+        std::tuple_size_v<typename _signature::parameters>);
+    int rc;
+    if constexpr (detail::is_window_aggregate<Aggregate>) {
+      rc = sqlite3_create_window_function(
+          native_handle(), name_tag_of_t<NameTag>::name, argument_count,
+          SQLITE_UTF8 | flags, nullptr, &_callbacks::step,
+          &_callbacks::finalize, &_callbacks::value, &_callbacks::inverse,
+          nullptr);
+    } else {
+      rc = sqlite3_create_window_function(
+          native_handle(), name_tag_of_t<NameTag>::name, argument_count,
+          SQLITE_UTF8 | flags, nullptr, &_callbacks::step,
+          &_callbacks::finalize, nullptr, nullptr, nullptr);
+    }
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(native_handle()), rc};
+    }
+    return typename _signature::template handle_t<user_aggregate_t, NameTag,
+                                                  _result_t>{};
+  }
+
+  //! runtime statistics of a prepared statement, accumulated over all of its
+  //! executions (since the last reset), see statement_status
+  template <typename PreparedStatement>
+    requires(sqlpp::is_prepared_statement_v<PreparedStatement>)
+  statement_status get_statement_status(PreparedStatement& p,
+                                        bool reset = false) {
+    return sqlpp::statement_handler_t{}.get_prepared_statement(p).get_status(
+        reset);
+  }
+
+  //! call `callback` for each row inserted, updated, or deleted via this
+  //! connection, see row_change (an empty callback removes the hook)
+  void set_update_hook(std::function<void(const row_change&)> callback) {
+    _change_hooks().on_change = std::move(callback);
+  }
+
+  //! call `callback` with operation and rowid for each row inserted, updated,
+  //! or deleted in the given table via this connection
+  template <typename Table>
+    requires(sqlpp::is_raw_table_v<Table>)
+  void add_table_hook(
+      const Table& /*table*/,
+      std::function<void(change_operation, int64_t)> callback) {
+    _change_hooks().table_hooks.push_back(
+        {name_tag_of_t<Table>::name, std::move(callback)});
+  }
+
+  //! call `callback` before a transaction is committed (including implicit
+  //! transactions of single statements)
+  void set_commit_hook(std::function<void()> callback) {
+    _change_hooks().on_commit = std::move(callback);
+  }
+
+  //! call `callback` when a transaction is rolled back
+  void set_rollback_hook(std::function<void()> callback) {
+    _change_hooks().on_rollback = std::move(callback);
+  }
+
+  //! remove all update, table, commit, and rollback hooks
+  void clear_hooks() {
+    if (_handle.hooks) {
+      *_handle.hooks = {};
+    }
+  }
+
+  //! open the blob in the given column and row for incremental I/O, see
+  //! blob_handle
+  template <typename Column>
+    requires(sqlpp::is_column_v<Column> and sqlpp::is_blob<Column>::value and
+             sqlpp::is_raw_table_v<typename Column::_table>)
+  blob_handle open_blob(const Column& /*column*/,
+                        int64_t rowid,
+                        blob_mode mode = blob_mode::read_only) {
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::statement,
+                          "Sqlite3 debug: opening blob {}.{} in row {}",
+                          name_tag_of_t<typename Column::_table>::name,
+                          name_tag_of_t<Column>::name, rowid);
+    }
+    return {native_handle(),
+            "main",
+            name_tag_of_t<typename Column::_table>::name,
+            name_tag_of_t<Column>::name,
+            rowid,
+            mode};
+  }
+
+  //! start copying the database at `path` into this connection, e.g. to load
+  //! a file database into a `:memory:` connection, see backup_t
+  backup_t start_load_from_file(const std::string& path) {
+    auto* file = detail::open_database(path, SQLITE_OPEN_READONLY);
+    return backup_t{native_handle(), file, file};
+  }
+
+  //! start copying the database of this connection into the database at
+  //! `path` (which is created if necessary), see backup_t
+  backup_t start_save_to_file(const std::string& path) {
+    auto* file = detail::open_database(
+        path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+    return backup_t{file, native_handle(), file};
+  }
+
+  //! copy the database at `path` into this connection, calling
+  //! `on_progress(backup_progress)` after each step of `pages_per_step` pages
+  //! (-1 copies all pages in one step)
+  template <typename Progress = detail::ignore_progress>
+  void load_from_file(const std::string& path,
+                      int pages_per_step = -1,
+                      Progress&& on_progress = {}) {
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::connection,
+                          "Sqlite3 debug: loading database from {}", path);
+    }
+    start_load_from_file(path).run(pages_per_step, on_progress);
+  }
+
+  //! copy the database of this connection into the database at `path`,
+  //! calling `on_progress(backup_progress)` after each step of
+  //! `pages_per_step` pages (-1 copies all pages in one step)
+  template <typename Progress = detail::ignore_progress>
+  void save_to_file(const std::string& path,
+                    int pages_per_step = -1,
+                    Progress&& on_progress = {}) {
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::connection,
+                          "Sqlite3 debug: saving database to {}", path);
+    }
+    start_save_to_file(path).run(pages_per_step, on_progress);
+  }
+
   //! set the transaction isolation level for this connection
   void set_default_isolation_level(isolation_level level) {
     if (level == sqlpp::isolation_level::read_uncommitted) {
@@ -392,6 +803,16 @@ class connection_base : public sqlpp::connection {
 
   ::sqlite3* native_handle() const { return _handle.native_handle(); }
 
+  //! hits and misses of the statement cache for direct execution, see
+  //! connection_config::statement_cache_size
+  statement_cache_stats get_statement_cache_stats() const {
+    return _handle.statements.stats();
+  }
+
+  const std::shared_ptr<const connection_config>& get_config() {
+    return _handle.config;
+  }
+
   schema_t attach(const connection_config& config, const std::string& name) {
     context_t context{this};
     auto prepared = prepare_statement(
@@ -420,12 +841,39 @@ class connection_base : public sqlpp::connection {
   // Constructors
   connection_base() = default;
   connection_base(_handle_t handle) : _handle{std::move(handle)} {}
+
+  // Used by `cached` (see sqlpp::common_connection) and auto-parameterization.
+  void _collect_literals(context_t& context, _literals_t& literals) {
+    context._literals = &literals;
+    context._max_literals = static_cast<size_t>(
+        sqlite3_limit(native_handle(), SQLITE_LIMIT_VARIABLE_NUMBER, -1));
+  }
+
+  template <typename Statement>
+  _prepared_statement_t _prepare_cached(const std::string& statement,
+                                        const context_t& context) {
+    return prepare_impl(statement,
+                        active_parameters<Statement>(context._parameters));
+  }
+
+  // Bindings are kept when the statement is reset.
+  static void _bind_cached_literals(_prepared_statement_t& prepared,
+                                    _literals_t literals,
+                                    const std::vector<size_t>& positions) {
+    for (size_t i = 0; i < literals.size(); ++i) {
+      prepared.bind_literal(positions[i], literals[i]);
+    }
+  }
 };
 
 inline auto context_t::escape(std::string_view t) -> std::string {
   return _db->escape(t);
 }
 
+inline auto context_t::date_time_storage() const -> chrono_storage {
+  return _db->get_config()->date_time_storage;
+}
+
 using connection = sqlpp::normal_connection<connection_base>;
 using pooled_connection = sqlpp::pooled_connection<connection_base>;
 }  // namespace sqlpp::sqlite3
@@ -27,11 +27,22 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <sqlpp23/core/debug_logger.h>
+#include <sqlpp23/sqlite3/database/statement_status.h>
 
 namespace sqlpp::sqlite3 {
+// How dates, times of day, and timestamps are stored.
+enum class chrono_storage {
+  text,           // e.g. '2024-01-31', '12:00:00.123456'
+  integer_epoch,  // days since epoch (dates), microseconds since epoch
+                  // (timestamps) or since midnight (times of day)
+};
+
 struct connection_config {
   connection_config() = default;
   connection_config(const connection_config&) = default;
@@ -56,7 +67,13 @@ struct connection_config {
     return (other.path_to_database == path_to_database &&
             other.flags == flags && other.vfs == vfs &&
             other.password == password &&
-            other.use_extended_result_codes == use_extended_result_codes);
+            other.use_extended_result_codes == use_extended_result_codes &&
+            other.statement_cache_size == statement_cache_size &&
+            other.auto_parameterize == auto_parameterize &&
+            other.prepared_statement_cache_size ==
+                prepared_statement_cache_size &&
+            other.pragmas == pragmas &&
+            other.date_time_storage == date_time_storage);
   }
 
   bool operator!=(const connection_config& other) const {
@@ -69,5 +86,26 @@ struct connection_config {
   std::string password;
   debug_logger debug;  // not compared
   bool use_extended_result_codes = false;
+  // Number of statements cached for direct execution (0 = no caching).
+  size_t statement_cache_size = 0;
+  // Replace literal values by parameters in direct execution, so that
+  // statements which only differ in values share the same SQL text (and
+  // cached statement). Literals beyond SQLITE_LIMIT_VARIABLE_NUMBER are
+  // serialized inline.
+  bool auto_parameterize = false;
+  // Number of statements cached by `cached` and `run_cached` (0: none).
+  size_t prepared_statement_cache_size = 32;
+  // Pragmas to apply after opening the database, in the given order, e.g.
+  // {"synchronous", "NORMAL"} results in `PRAGMA synchronous = NORMAL`.
+  std::vector<std::pair<std::string, std::string>> pragmas;
+  // Storage of chrono parameters and literals. Results are read from either
+  // representation, depending on the type of the value.
+  chrono_storage date_time_storage = chrono_storage::text;
+  // Kept alive as long as the config is in use, e.g. the in-memory database
+  // of a snapshot, see load_snapshot (not compared).
+  std::shared_ptr<void> keep_alive;
+  // Called with the runtime statistics of each statement that has run to
+  // completion; the statement's counters are reset afterwards (not compared).
+  statement_status_callback_t statement_status_callback;
 };
 }  // namespace sqlpp::sqlite3
@@ -29,6 +29,7 @@
  */
 
 #include <memory>
+#include <string>
 
 #ifdef SQLPP_USE_SQLCIPHER
 #include <sqlcipher/sqlite3.h>
@@ -36,19 +37,34 @@
 #include <sqlite3.h>
 #endif
 
+#include <sqlpp23/core/database/prepared_statement_cache.h>
+#include <sqlpp23/sqlite3/database/carray_module.h>
+#include <sqlpp23/sqlite3/database/change_hooks.h>
 #include <sqlpp23/sqlite3/database/connection_config.h>
 #include <sqlpp23/sqlite3/database/exception.h>
+#include <sqlpp23/sqlite3/database/statement_cache.h>
 
 namespace sqlpp::sqlite3::detail {
 struct connection_handle {
   std::shared_ptr<const connection_config> config;
+  // Declared before sqlite, so that hooks outlive the database (closing it
+  // might roll back a transaction). Created on demand.
+  std::unique_ptr<change_hooks> hooks;
   std::unique_ptr<::sqlite3, int (*)(::sqlite3*)> sqlite;
+  // Declared after sqlite, so that statements are finalized before the
+  // database is closed.
+  statement_cache statements;
+  sqlpp::detail::prepared_statement_cache prepared_statements;
 
   connection_handle()
-      : config{}, sqlite{nullptr, sqlite3_close} {}
+      : config{}, hooks{}, sqlite{nullptr, sqlite3_close} {}
 
   connection_handle(const std::shared_ptr<const connection_config>& conf)
-      : config{conf}, sqlite{nullptr, sqlite3_close} {
+      : config{conf},
+        hooks{},
+        sqlite{nullptr, sqlite3_close},
+        statements{conf->statement_cache_size},
+        prepared_statements{conf->prepared_statement_cache_size} {
     {
       ::sqlite3* sqlite_ptr;
       const auto rc = sqlite3_open_v2(
@@ -66,6 +82,11 @@ struct connection_handle {
       }
     }
 
+    if (const auto rc = sqlite3_create_module_v2(
+            native_handle(), carray_name, carray_module(), nullptr, nullptr)) {
+      throw exception{sqlite3_errmsg(native_handle()), rc};
+    }
+
 #ifdef SQLITE_HAS_CODEC
     if (conf->password.size() > 0) {
       int ret = sqlite3_key(native_handle(), conf->password.data(),
@@ -75,12 +96,29 @@ struct connection_handle {
       }
     }
 #endif
+
+    for (const auto& [name, value] : conf->pragmas) {
+      const auto statement = "PRAGMA " + name + " = " + value;
+      if (const auto rc = sqlite3_exec(native_handle(), statement.c_str(),
+                                       nullptr, nullptr, nullptr)) {
+        throw exception{sqlite3_errmsg(native_handle()), rc};
+      }
+    }
   }
 
   connection_handle(const connection_handle&) = delete;
   connection_handle(connection_handle&&) = default;
   connection_handle& operator=(const connection_handle&) = delete;
-  connection_handle& operator=(connection_handle&&) = default;
+  connection_handle& operator=(connection_handle&& rhs) {
+    // Finalize cached statements before closing the database.
+    prepared_statements = std::move(rhs.prepared_statements);
+    statements = std::move(rhs.statements);
+    config = std::move(rhs.config);
+    sqlite = std::move(rhs.sqlite);
+    hooks = std::move(rhs.hooks);
+    return *this;
+  }
+  ~connection_handle() = default;
 
   ::sqlite3* native_handle() const { return sqlite.get(); }
 
@@ -98,6 +136,17 @@ struct connection_handle {
                          nullptr) == SQLITE_OK);
   }
 
+  // Called by the connection pool before the handle is reused: Hooks belong
+  // to the previous user of the connection.
+  void reset_session() {
+    if (hooks) {
+      if (is_connected()) {
+        change_hooks::unregister_from(native_handle());
+      }
+      hooks.reset();
+    }
+  }
+
   const debug_logger& debug() { return config->debug; }
 };
 }  // namespace sqlpp::sqlite3::detail
@@ -27,9 +27,62 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
 #include <sqlpp23/core/database/connection_pool.h>
+#include <sqlpp23/sqlite3/database/backup.h>
 #include <sqlpp23/sqlite3/database/connection.h>
 
 namespace sqlpp::sqlite3 {
 using connection_pool = sqlpp::connection_pool<connection_base>;
+
+// Loads the database at `path` into a new in-memory database and switches
+// `pool` to it, see connection_pool::reconfigure. Connections created by the
+// pool afterwards share the in-memory database (using the memdb VFS).
+// Connections to the previous snapshot remain usable until they are returned
+// to the pool. The in-memory database is freed when its config is no longer
+// in use.
+//
+// `config` provides the remaining settings for the pooled connections, e.g.
+// flags, pragmas, or debug settings. `on_progress(backup_progress)` is called
+// after each step of `pages_per_step` pages (-1 copies all pages at once).
+template <typename Progress = detail::ignore_progress>
+std::shared_ptr<const connection_config> load_snapshot(
+    connection_pool& pool,
+    const connection_config& config,
+    const std::string& path,
+    int pages_per_step = -1,
+    Progress&& on_progress = {}) {
+  static std::atomic<uint64_t> snapshot_count{0};
+  auto snapshot_config = std::make_shared<connection_config>(config);
+  snapshot_config->path_to_database = "file:/sqlpp23_snapshot_" +
+                                      std::to_string(++snapshot_count) +
+                                      "?vfs=memdb";
+  snapshot_config->flags =
+      (config.flags ? config.flags : SQLITE_OPEN_READWRITE) | SQLITE_OPEN_URI;
+  snapshot_config->vfs.clear();
+
+  // Keeps the in-memory database alive while the config is in use.
+  auto* owner = detail::open_database(
+      snapshot_config->path_to_database,
+      SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI);
+  snapshot_config->keep_alive =
+      std::shared_ptr<::sqlite3>{owner, sqlite3_close};
+
+  if constexpr (debug_enabled) {
+    config.debug.log(log_category::connection,
+                     "Sqlite3 debug: loading snapshot of {} into {}", path,
+                     snapshot_config->path_to_database);
+  }
+  {
+    auto* file = detail::open_database(path, SQLITE_OPEN_READONLY);
+    backup_t{owner, file, file}.run(pages_per_step, on_progress);
+  }
+
+  pool.reconfigure(snapshot_config);
+  return snapshot_config;
+}
 }  // namespace sqlpp::sqlite3
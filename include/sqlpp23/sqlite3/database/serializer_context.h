@@ -28,13 +28,26 @@
  */
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <typeindex>
+#include <variant>
+#include <vector>
+
+#include <sqlpp23/sqlite3/database/connection_config.h>
 
 namespace sqlpp::sqlite3 {
 
 class connection_base;
 
+namespace detail {
+// Value of a literal that is replaced by a parameter, see
+// connection_config::auto_parameterize.
+using literal_parameter =
+    std::variant<int64_t, double, std::string, std::vector<uint8_t>>;
+}  // namespace detail
+
 // Context for serialization
 struct context_t {
   explicit context_t(connection_base* db) : _db(db) {}
@@ -45,9 +58,17 @@ struct context_t {
 
   // The implementation is in connection.h
   auto escape(std::string_view t) -> std::string;
+  auto date_time_storage() const -> chrono_storage;
 
   size_t _count = 0;
   connection_base* _db;
+  // Parameters in order of serialization, see sqlpp::record_parameter.
+  std::vector<std::type_index> _parameters;
+  // If set, literal values are serialized as parameters and collected here.
+  std::vector<detail::literal_parameter>* _literals = nullptr;
+  // Maximum number of parameters (SQLITE_LIMIT_VARIABLE_NUMBER). Literals
+  // beyond this limit are serialized inline.
+  size_t _max_literals = 0;
 };
 
 }  // namespace sqlpp::postgresql
@@ -0,0 +1,128 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3 {
+struct statement_cache_stats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+};
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp::sqlite3::detail {
+// Least recently used cache of compiled statements, keyed by SQL text.
+// Used for direct execution, see connection_config::statement_cache_size.
+class statement_cache {
+  struct entry {
+    std::string sql;
+    std::shared_ptr<::sqlite3_stmt> statement;
+  };
+
+  size_t _capacity = 0;
+  std::list<entry> _entries;  // most recently used first
+  // Keys refer to the sql strings in _entries.
+  std::unordered_map<std::string_view, std::list<entry>::iterator> _index;
+  statement_cache_stats _stats;
+
+ public:
+  statement_cache() = default;
+  explicit statement_cache(size_t capacity) : _capacity{capacity} {}
+  statement_cache(const statement_cache&) = delete;
+  statement_cache(statement_cache&&) = default;
+  statement_cache& operator=(const statement_cache&) = delete;
+  statement_cache& operator=(statement_cache&&) = default;
+  ~statement_cache() = default;
+
+  size_t capacity() const { return _capacity; }
+  size_t size() const { return _entries.size(); }
+  const statement_cache_stats& stats() const { return _stats; }
+
+  // Returns the reset statement for `sql` or nullptr if there is no such
+  // statement or it is still in use (e.g. by a result that is being iterated
+  // over).
+  std::shared_ptr<::sqlite3_stmt> acquire(std::string_view sql) {
+    const auto it = _index.find(sql);
+    if (it == _index.end() or it->second->statement.use_count() > 1) {
+      ++_stats.misses;
+      return nullptr;
+    }
+    ++_stats.hits;
+    _entries.splice(_entries.begin(), _entries, it->second);
+    sqlite3_reset(it->second->statement.get());
+    return _lend(it->second->statement);
+  }
+
+  // Adds the statement to the cache (evicting the least recently used
+  // statement if necessary) and returns it for use.
+  std::shared_ptr<::sqlite3_stmt> insert(
+      std::string_view sql,
+      std::shared_ptr<::sqlite3_stmt> statement) {
+    if (_capacity == 0 or _index.contains(sql)) {
+      return statement;
+    }
+    if (_entries.size() == _capacity) {
+      // Statements that are still in use are finalized by their last user.
+      _index.erase(_entries.back().sql);
+      _entries.pop_back();
+    }
+    _entries.push_front(entry{std::string{sql}, std::move(statement)});
+    _index.emplace(_entries.front().sql, _entries.begin());
+    return _lend(_entries.front().statement);
+  }
+
+  void clear() {
+    _index.clear();
+    _entries.clear();
+  }
+
+ private:
+  // The returned pointer keeps the cached statement alive and resets it when
+  // released, so that it does not hold on to locks while sitting in the
+  // cache.
+  static std::shared_ptr<::sqlite3_stmt> _lend(
+      const std::shared_ptr<::sqlite3_stmt>& statement) {
+    return std::shared_ptr<::sqlite3_stmt>{
+        statement.get(),
+        [statement](::sqlite3_stmt* native) { sqlite3_reset(native); }};
+  }
+};
+}  // namespace sqlpp::sqlite3::detail
@@ -0,0 +1,140 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3 {
+// One loop of a statement's query plan, see
+// https://www.sqlite.org/c3ref/stmt_scanstatus.html
+struct scan_status {
+  int select_id;
+  int parent_id;
+  int64_t loops;          // number of times the loop was run
+  int64_t rows_visited;   // total number of rows visited
+  double estimated_rows;  // estimated rows per loop (query planner)
+  int64_t cycles;         // CPU cycles, if SQLite measures them
+  std::string name;       // table or index
+  std::string explain;    // as in EXPLAIN QUERY PLAN
+};
+
+// Runtime counters of a statement, see
+// https://www.sqlite.org/c3ref/c_stmtstatus_counter.html
+struct statement_status {
+  int64_t fullscan_steps;  // steps in full table scans
+  int64_t sorts;
+  int64_t autoindex;  // rows inserted into automatic indexes
+  int64_t vm_steps;
+  int64_t reprepares;
+  int64_t runs;
+  int64_t memory_used;  // bytes
+  // Per-loop statistics. Only available if SQLite (3.42 or later) and sqlpp23
+  // are compiled with SQLITE_ENABLE_STMT_SCANSTATUS.
+  std::vector<scan_status> scans;
+};
+
+// Receives the SQL and status of a statement that has run to completion.
+using statement_status_callback_t =
+    std::function<void(std::string_view, const statement_status&)>;
+
+namespace detail {
+inline std::vector<scan_status> get_scan_status(
+    [[maybe_unused]] ::sqlite3_stmt* statement,
+    [[maybe_unused]] bool reset) {
+  auto scans = std::vector<scan_status>{};
+#if defined(SQLITE_ENABLE_STMT_SCANSTATUS) and defined(SQLITE_SCANSTAT_COMPLEX)
+  for (int i = 0;; ++i) {
+    auto scan = scan_status{};
+    const char* name = nullptr;
+    const char* explain = nullptr;
+    if (sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_NLOOP,
+                                   SQLITE_SCANSTAT_COMPLEX, &scan.loops)) {
+      break;
+    }
+    sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_NVISIT,
+                               SQLITE_SCANSTAT_COMPLEX, &scan.rows_visited);
+    sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_EST,
+                               SQLITE_SCANSTAT_COMPLEX, &scan.estimated_rows);
+    sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_NCYCLE,
+                               SQLITE_SCANSTAT_COMPLEX, &scan.cycles);
+    sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_SELECTID,
+                               SQLITE_SCANSTAT_COMPLEX, &scan.select_id);
+    sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_PARENTID,
+                               SQLITE_SCANSTAT_COMPLEX, &scan.parent_id);
+    sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_NAME,
+                               SQLITE_SCANSTAT_COMPLEX, &name);
+    sqlite3_stmt_scanstatus_v2(statement, i, SQLITE_SCANSTAT_EXPLAIN,
+                               SQLITE_SCANSTAT_COMPLEX, &explain);
+    scan.name = name ? name : "";
+    scan.explain = explain ? explain : "";
+    scans.push_back(std::move(scan));
+  }
+  if (reset) {
+    sqlite3_stmt_scanstatus_reset(statement);
+  }
+#endif
+  return scans;
+}
+
+// Counters are reset if `reset` is true (except for memory_used).
+inline statement_status get_statement_status(::sqlite3_stmt* statement,
+                                             bool reset) {
+  const auto status = [&](int op) {
+    return static_cast<int64_t>(sqlite3_stmt_status(statement, op, reset));
+  };
+  return {.fullscan_steps = status(SQLITE_STMTSTATUS_FULLSCAN_STEP),
+          .sorts = status(SQLITE_STMTSTATUS_SORT),
+          .autoindex = status(SQLITE_STMTSTATUS_AUTOINDEX),
+          .vm_steps = status(SQLITE_STMTSTATUS_VM_STEP),
+          .reprepares = status(SQLITE_STMTSTATUS_REPREPARE),
+          .runs = status(SQLITE_STMTSTATUS_RUN),
+          .memory_used = static_cast<int64_t>(
+              sqlite3_stmt_status(statement, SQLITE_STMTSTATUS_MEMUSED, 0)),
+          .scans = get_scan_status(statement, reset)};
+}
+
+inline void report_statement_status(const statement_status_callback_t& callback,
+                                    ::sqlite3_stmt* statement) {
+  if (callback) {
+    const auto status = get_statement_status(statement, true);
+    callback(sqlite3_sql(statement), status);
+  }
+}
+}  // namespace detail
+}  // namespace sqlpp::sqlite3
@@ -0,0 +1,266 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/sqlite3/database/connection.h>
+#include <sqlpp23/sqlite3/database/connection_pool.h>
+
+namespace sqlpp::sqlite3 {
+namespace detail {
+class write_task_base {
+ public:
+  virtual ~write_task_base() = default;
+
+  // Runs the task. The outcome is kept until the batch is committed.
+  virtual void run(connection& db) = 0;
+  virtual bool failed() const = 0;
+  // Publishes the outcome of the task.
+  virtual void publish() = 0;
+  // Publishes `error`, unless the task failed on its own.
+  virtual void fail(std::exception_ptr error) = 0;
+};
+
+template <typename Function>
+class write_task : public write_task_base {
+  using _result_t = std::invoke_result_t<Function&, connection&>;
+  using _value_t =
+      std::conditional_t<std::is_void_v<_result_t>, bool, _result_t>;
+
+  Function _function;
+  std::promise<_result_t> _promise;
+  std::optional<_value_t> _value;
+  std::exception_ptr _error;
+
+ public:
+  explicit write_task(Function function) : _function{std::move(function)} {}
+
+  std::future<_result_t> get_future() { return _promise.get_future(); }
+
+  void run(connection& db) override {
+    try {
+      if constexpr (std::is_void_v<_result_t>) {
+        std::invoke(_function, db);
+        _value.emplace(true);
+      } else {
+        _value.emplace(std::invoke(_function, db));
+      }
+    } catch (...) {
+      _error = std::current_exception();
+    }
+  }
+
+  bool failed() const override { return _error != nullptr; }
+
+  void publish() override {
+    if (_error) {
+      _promise.set_exception(_error);
+    } else if constexpr (std::is_void_v<_result_t>) {
+      _promise.set_value();
+    } else {
+      _promise.set_value(std::move(*_value));
+    }
+  }
+
+  void fail(std::exception_ptr error) override {
+    _promise.set_exception(_error ? _error : error);
+  }
+};
+}  // namespace detail
+
+// A pool for databases in WAL mode: SQLite allows many concurrent readers but
+// only one writer at a time. Instead of letting threads compete for the write
+// lock (and get SQLITE_BUSY), write tasks are queued and executed by a single
+// writer thread. Queued tasks are group-committed, i.e. executed in one
+// transaction, each task in its own savepoint.
+//
+// Read-only connections are taken from a connection pool. Pragmas from the
+// connection config (e.g. synchronous, mmap_size, cache_size) are applied to
+// all connections.
+class wal_pool {
+  connection _writer;
+  connection_pool _readers;
+  size_t _max_batch_size;
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<std::unique_ptr<detail::write_task_base>> _tasks;
+  bool _stopping = false;
+  std::thread _writer_thread;  // started at the end of the constructor
+
+ public:
+  // `config` is used for the writer (it should allow writing and creating
+  // the database). Readers use the same config, but open the database
+  // read-only. The database cannot be in-memory.
+  wal_pool(const std::shared_ptr<const connection_config>& config,
+           size_t readers,
+           size_t max_batch_size = 64)
+      : _writer{make_writer_config(config)},
+        _readers{make_reader_config(config), readers},
+        _max_batch_size{max_batch_size == 0 ? 1 : max_batch_size} {
+    // Open the read-only connections up front.
+    auto connections = std::vector<pooled_connection>{};
+    connections.reserve(readers);
+    for (size_t i = 0; i < readers; ++i) {
+      connections.push_back(_readers.get(connection_check::none));
+    }
+    // Started last: if anything above throws, there is no thread to join.
+    _writer_thread = std::thread{[this] { run_writer(); }};
+  }
+
+  wal_pool(const wal_pool&) = delete;
+  wal_pool(wal_pool&&) = delete;
+  wal_pool& operator=(const wal_pool&) = delete;
+  wal_pool& operator=(wal_pool&&) = delete;
+
+  // Executes all queued write tasks before returning.
+  ~wal_pool() {
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _stopping = true;
+    }
+    _condition.notify_one();
+    _writer_thread.join();
+  }
+
+  // Returns a read-only connection. It is returned to the pool when it goes
+  // out of scope.
+  pooled_connection get_reader(
+      connection_check check = connection_check::passive) {
+    return _readers.get(check);
+  }
+
+  // Queues `function` to be called with the writer connection. The returned
+  // future becomes ready once the transaction containing the task has been
+  // committed. If the task throws, its changes are rolled back and the future
+  // holds the exception. Tasks must not start or end transactions.
+  template <typename Function>
+    requires(std::is_invocable_v<Function&, connection&>)
+  auto write(Function function)
+      -> std::future<std::invoke_result_t<Function&, connection&>> {
+    auto task =
+        std::make_unique<detail::write_task<Function>>(std::move(function));
+    auto future = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _tasks.push_back(std::move(task));
+    }
+    _condition.notify_one();
+    return future;
+  }
+
+  // Number of idle read-only connections. Only used in tests.
+  size_t available_readers() { return _readers.available(); }
+
+ private:
+  static std::shared_ptr<const connection_config> make_writer_config(
+      const std::shared_ptr<const connection_config>& config) {
+    auto writer_config = std::make_shared<connection_config>(*config);
+    // Needs to be set before any other pragma takes effect on the database.
+    writer_config->pragmas.insert(writer_config->pragmas.begin(),
+                                  {"journal_mode", "WAL"});
+    return writer_config;
+  }
+
+  static std::shared_ptr<const connection_config> make_reader_config(
+      const std::shared_ptr<const connection_config>& config) {
+    auto reader_config = std::make_shared<connection_config>(*config);
+    reader_config->flags =
+        (config->flags & ~(SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE)) |
+        SQLITE_OPEN_READONLY;
+    return reader_config;
+  }
+
+  void run_writer() {
+    for (;;) {
+      auto batch = std::vector<std::unique_ptr<detail::write_task_base>>{};
+      {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _condition.wait(lock,
+                        [this] { return _stopping or not _tasks.empty(); });
+        if (_tasks.empty()) {
+          return;
+        }
+        while (not _tasks.empty() and batch.size() < _max_batch_size) {
+          batch.push_back(std::move(_tasks.front()));
+          _tasks.pop_front();
+        }
+      }
+      execute_batch(batch);
+    }
+  }
+
+  void execute_batch(
+      std::vector<std::unique_ptr<detail::write_task_base>>& batch) {
+    if constexpr (debug_enabled) {
+      _writer.get_config()->debug.log(
+          log_category::connection,
+          "Sqlite3 debug: group-committing {} write tasks", batch.size());
+    }
+    try {
+      _writer("BEGIN IMMEDIATE");
+      for (auto& task : batch) {
+        _writer("SAVEPOINT sqlpp_write_task");
+        task->run(_writer);
+        if (task->failed()) {
+          _writer("ROLLBACK TO sqlpp_write_task");
+        }
+        _writer("RELEASE sqlpp_write_task");
+      }
+      _writer("COMMIT");
+    } catch (...) {
+      const auto error = std::current_exception();
+      if (not sqlite3_get_autocommit(_writer.native_handle())) {
+        sqlite3_exec(_writer.native_handle(), "ROLLBACK", nullptr, nullptr,
+                     nullptr);
+      }
+      for (auto& task : batch) {
+        task->fail(error);
+      }
+      return;
+    }
+    for (auto& task : batch) {
+      task->publish();
+    }
+  }
+};
+}  // namespace sqlpp::sqlite3
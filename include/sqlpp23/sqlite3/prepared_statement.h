@@ -27,10 +27,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 
 #ifdef SQLPP_USE_SQLCIPHER
@@ -40,8 +42,12 @@
 #endif
 
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/database/parameter_list.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/sqlite3/database/exception.h>
 #include <sqlpp23/sqlite3/database/connection_config.h>
+#include <sqlpp23/sqlite3/database/serializer_context.h>
+#include <sqlpp23/sqlite3/database/statement_status.h>
 
 namespace sqlpp::sqlite3 {
 // Forward declaration
@@ -51,13 +57,16 @@ class prepared_statement_t {
   friend class ::sqlpp::sqlite3::connection_base;
   ::sqlite3* _connection;
   std::shared_ptr<sqlite3_stmt> _sqlite3_statement;
+  // Buffers for date and time parameters, bound with SQLITE_STATIC.
+  std::vector<std::array<char, 32>> _parameter_buffers;
   const connection_config* config;
 
  public:
   prepared_statement_t() = delete;
   prepared_statement_t(::sqlite3* connection,
                        std::string_view statement,
-                       const connection_config* config_)
+                       const connection_config* config_,
+                       unsigned int prepare_flags = 0)
       : _connection{connection}, _sqlite3_statement{nullptr}, config{config_} {
     if constexpr (debug_enabled) {
       config->debug.log(log_category::statement, "Preparing: '{}'", statement);
@@ -77,9 +86,10 @@ class prepared_statement_t {
 
     ::sqlite3_stmt* native_handle = nullptr;
     const char* uncompiledTail = nullptr;
-    const auto rc = ::sqlite3_prepare_v2(connection, statement.data(),
+    const auto rc = ::sqlite3_prepare_v3(connection, statement.data(),
                                          static_cast<int>(length),
-                                         &native_handle, &uncompiledTail);
+                                         prepare_flags, &native_handle,
+                                         &uncompiledTail);
     _sqlite3_statement =
         std::shared_ptr<::sqlite3_stmt>{native_handle, sqlite3_finalize};
 
@@ -92,7 +102,20 @@ class prepared_statement_t {
           "Sqlite3 connector: Cannot execute multi-statements: >>" +
           std::string(statement) + "<<\n"};
     }
+
+    _parameter_buffers.resize(static_cast<size_t>(
+        sqlite3_bind_parameter_count(_sqlite3_statement.get())));
   }
+  // Wraps an already compiled statement, e.g. from the statement cache.
+  prepared_statement_t(::sqlite3* connection,
+                       std::shared_ptr<::sqlite3_stmt> statement,
+                       const connection_config* config_)
+      : _connection{connection},
+        _sqlite3_statement{std::move(statement)},
+        _parameter_buffers(static_cast<size_t>(sqlite3_bind_parameter_count(
+            _sqlite3_statement.get()))),  // ()-init for correct constructor
+        config{config_} {}
+
   prepared_statement_t(const prepared_statement_t&) = delete;
   prepared_statement_t(prepared_statement_t&& rhs) = default;
   prepared_statement_t& operator=(const prepared_statement_t&) = delete;
@@ -106,6 +129,15 @@ class prepared_statement_t {
   ::sqlite3_stmt* native_handle() { return _sqlite3_statement.get(); }
   const debug_logger& debug() const { return config->debug; }
 
+  // The SQL text the statement was compiled from.
+  std::string_view sql() const {
+    return sqlite3_sql(_sqlite3_statement.get());
+  }
+
+  statement_status get_status(bool reset = false) {
+    return detail::get_statement_status(_sqlite3_statement.get(), reset);
+  }
+
   void _reset() {
     if constexpr (debug_enabled) {
       config->debug.log(log_category::statement,
@@ -172,34 +204,36 @@ class prepared_statement_t {
   }
 
   void bind_parameter(size_t parameter_index, const std::chrono::microseconds& value) {
-   const auto text = std::format("{0:%H:%M:%S}", value);
-    const int rc = sqlite3_bind_text(
-        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text.data(),
-        static_cast<int>(text.size()), SQLITE_TRANSIENT);
-    if (rc != SQLITE_OK) {
-      throw exception{sqlite3_errmsg(_connection), rc};
+    if (config->date_time_storage == chrono_storage::integer_epoch) {
+      bind_parameter(parameter_index, static_cast<int64_t>(value.count()));
+      return;
     }
+    bind_chars(parameter_index, [&](char* first, char* last) {
+      return ::sqlpp::detail::time_of_day_to_chars(first, last, value);
+    });
   }
 
   void bind_parameter(size_t parameter_index, const std::chrono::sys_days& value) {
-    const auto text = std::format("{0:%Y-%m-%d}", value);
-    const int rc = sqlite3_bind_text(
-        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text.data(),
-        static_cast<int>(text.size()), SQLITE_TRANSIENT);
-    if (rc != SQLITE_OK) {
-      throw exception{sqlite3_errmsg(_connection), rc};
+    if (config->date_time_storage == chrono_storage::integer_epoch) {
+      bind_parameter(parameter_index,
+                     static_cast<int64_t>(value.time_since_epoch().count()));
+      return;
     }
+    bind_chars(parameter_index, [&](char* first, char* last) {
+      return ::sqlpp::detail::date_to_chars(first, last, value);
+    });
   }
 
   void bind_parameter(size_t parameter_index,
                        const ::sqlpp::chrono::sys_microseconds& value) {
-    const auto text = std::format("{0:%Y-%m-%d %H:%M:%S}", value);
-    const int rc = sqlite3_bind_text(
-        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text.data(),
-        static_cast<int>(text.size()), SQLITE_TRANSIENT);
-    if (rc != SQLITE_OK) {
-      throw exception{sqlite3_errmsg(_connection), rc};
+    if (config->date_time_storage == chrono_storage::integer_epoch) {
+      bind_parameter(parameter_index,
+                     static_cast<int64_t>(value.time_since_epoch().count()));
+      return;
     }
+    bind_chars(parameter_index, [&](char* first, char* last) {
+      return ::sqlpp::detail::timestamp_to_chars(first, last, value);
+    });
   }
 
   void bind_parameter(size_t parameter_index, const std::vector<uint8_t>& value) {
@@ -211,6 +245,62 @@ class prepared_statement_t {
     }
   }
 
+  // Binds a literal that was replaced by a parameter, see
+  // connection_config::auto_parameterize. Text and blobs are copied, since
+  // the statement might be used after the literal is gone (e.g. in a result).
+  void bind_literal(size_t parameter_index,
+                    const detail::literal_parameter& value) {
+    const auto index = static_cast<int>(parameter_index + 1);
+    int rc;
+    if (const auto* integral = std::get_if<int64_t>(&value)) {
+      rc = sqlite3_bind_int64(_sqlite3_statement.get(), index, *integral);
+    } else if (const auto* floating_point = std::get_if<double>(&value)) {
+      rc = sqlite3_bind_double(_sqlite3_statement.get(), index,
+                               *floating_point);
+    } else if (const auto* text = std::get_if<std::string>(&value)) {
+      rc = sqlite3_bind_text(_sqlite3_statement.get(), index, text->data(),
+                             static_cast<int>(text->size()), SQLITE_TRANSIENT);
+    } else {
+      const auto& blob = std::get<std::vector<uint8_t>>(value);
+      rc = sqlite3_bind_blob(_sqlite3_statement.get(), index, blob.data(),
+                             static_cast<int>(blob.size()), SQLITE_TRANSIENT);
+    }
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(_connection), rc};
+    }
+  }
+
+  // Formats into the parameter's buffer to avoid allocations when the
+  // statement is executed repeatedly. Falls back to a larger temporary buffer
+  // in the unlikely case that the parameter's buffer is too small.
+  template <typename ToChars>
+  void bind_chars(size_t parameter_index, const ToChars& to_chars) {
+    auto& buffer = _parameter_buffers[parameter_index];
+    auto result = to_chars(buffer.data(), buffer.data() + buffer.size());
+    int rc;
+    if (result.ec == std::errc{}) {
+      rc = sqlite3_bind_text(_sqlite3_statement.get(),
+                             static_cast<int>(parameter_index + 1),
+                             buffer.data(),
+                             static_cast<int>(result.ptr - buffer.data()),
+                             SQLITE_STATIC);
+    } else {
+      auto text = std::array<char, ::sqlpp::detail::max_formatted_size>{};
+      result = to_chars(text.data(), text.data() + text.size());
+      if (result.ec != std::errc{}) {
+        throw sqlpp::exception{"Sqlite3 error: parameter value too large"};
+      }
+      rc = sqlite3_bind_text(_sqlite3_statement.get(),
+                             static_cast<int>(parameter_index + 1),
+                             text.data(),
+                             static_cast<int>(result.ptr - text.data()),
+                             SQLITE_TRANSIENT);
+    }
+    if (rc != SQLITE_OK) {
+      throw exception{sqlite3_errmsg(_connection), rc};
+    }
+  }
+
   void bind_null(size_t parameter_index) {
     if constexpr (debug_enabled) {
       config->debug.log(log_category::parameter,
@@ -224,6 +314,10 @@ class prepared_statement_t {
       throw exception{sqlite3_errmsg(_connection), rc};
     }
   }
+
+  // Positions of the parameters in the prepared statement (empty if all are
+  // in list order), see sqlpp::active_parameters.
+  parameter_positions_t _active_parameters;
 };
 
 inline void bind_parameter(prepared_statement_t& statement,
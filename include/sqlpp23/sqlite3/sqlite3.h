@@ -28,9 +28,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sqlpp23/sqlite3/carray.h>
 #include <sqlpp23/sqlite3/clause/delete_from.h>
 #include <sqlpp23/sqlite3/clause/insert.h>
 #include <sqlpp23/sqlite3/clause/insert_or.h>
 #include <sqlpp23/sqlite3/clause/update.h>
 #include <sqlpp23/sqlite3/database/connection.h>
 #include <sqlpp23/sqlite3/database/connection_pool.h>
+#include <sqlpp23/sqlite3/database/wal_pool.h>
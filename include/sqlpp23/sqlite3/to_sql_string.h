@@ -40,6 +40,8 @@
 #include <sqlpp23/core/clause/using.h>
 #include <sqlpp23/core/clause/with.h>
 #include <sqlpp23/core/database/exception.h>
+#include <sqlpp23/core/database/parameter_list.h>
+#include <sqlpp23/core/detail/value_codec.h>
 #include <sqlpp23/core/reader.h>
 #include <sqlpp23/core/type_traits.h>
 #include <sqlpp23/sqlite3/database/connection.h>
@@ -57,47 +59,200 @@ inline auto to_sql_string(context_t&, const truncate_t&) -> std::string {
 }
 
 template <typename L, typename R>
-auto to_sql_string(context_t& context,
-                   const comparison_expression<L, sqlpp::op_is_distinct_from, R>& t)
-    -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = operand_to_sql_string(context, read.lhs(t)) + " IS NOT ";
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+auto append_sql_string(
+    context_t& context,
+    std::string& out,
+    const comparison_expression<L, sqlpp::op_is_distinct_from, R>& t) -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += " IS NOT ";
+  append_operand_sql_string(context, out, read.rhs(t));
 }
 
 template <typename L, typename R>
-auto to_sql_string(context_t& context,
-                   const comparison_expression<L, sqlpp::op_is_not_distinct_from, R>& t)
-    -> std::string {
-  // Note: Temporary required to enforce parameter ordering.
-  auto ret_val = operand_to_sql_string(context, read.lhs(t)) + " IS ";
-  return ret_val + operand_to_sql_string(context, read.rhs(t));
+auto append_sql_string(
+    context_t& context,
+    std::string& out,
+    const comparison_expression<L, sqlpp::op_is_not_distinct_from, R>& t)
+    -> void {
+  append_operand_sql_string(context, out, read.lhs(t));
+  out += " IS ";
+  append_operand_sql_string(context, out, read.rhs(t));
 }
 
 // Serialize parameters
 template <typename DataType, typename NameType>
 auto to_sql_string(context_t& context, const parameter_t<DataType, NameType>&)
     -> std::string {
+  record_parameter<parameter_t<DataType, NameType>>(context._parameters);
   return "?" + std::to_string(++context._count);
 }
 
+namespace detail {
+// Literals are collected as long as the statement does not exceed the maximum
+// number of parameters, e.g. in a long `in` list or a multi-row insert.
+inline auto collects_literal(const context_t& context) -> bool {
+  return context._literals and context._count < context._max_literals;
+}
+
+// Replaces the literal by a parameter if the context collects literals (see
+// connection_config::auto_parameterize). Otherwise, the literal is serialized
+// as usual.
+template <typename T>
+auto literal_to_sql_string(context_t& context, const T& t) -> std::string {
+  if (collects_literal(context)) {
+    if constexpr (std::is_floating_point_v<T>) {
+      // Bound like NaN and Inf parameters, see prepared_statement_t.
+      if (std::isnan(t)) {
+        context._literals->emplace_back(std::string{"NaN"});
+      } else if (std::isinf(t)) {
+        context._literals->emplace_back(std::string{t > 0 ? "Inf" : "-Inf"});
+      } else {
+        context._literals->emplace_back(static_cast<double>(t));
+      }
+    } else if constexpr (std::is_same_v<T, std::string_view>) {
+      context._literals->emplace_back(std::string{t});
+    } else if constexpr (std::is_same_v<T, std::span<const uint8_t>>) {
+      context._literals->emplace_back(
+          std::vector<uint8_t>{t.begin(), t.end()});
+    } else {
+      context._literals->emplace_back(static_cast<int64_t>(t));
+    }
+    record_literal(context._parameters);
+    return "?" + std::to_string(++context._count);
+  }
+  return ::sqlpp::to_sql_string(context, t);
+}
+
+// Replaces the date/time value of an SQL function call (e.g.
+// `DATE('2025-01-01')`) by a parameter if the context collects literals.
+inline auto chrono_to_sql_string(context_t& context,
+                                 std::string_view function,
+                                 std::string value,
+                                 std::string_view modifiers) -> std::string {
+  auto result = std::string{function} + '(';
+  if (collects_literal(context)) {
+    result += '?' + std::to_string(++context._count);
+    context._literals->emplace_back(std::move(value));
+    record_literal(context._parameters);
+  } else {
+    result += '\'' + value + '\'';
+  }
+  result += modifiers;
+  result += ')';
+  return result;
+}
+}  // namespace detail
+
+inline auto to_sql_string(context_t& context, const bool& t) -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const int8_t& t) -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const int16_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const int32_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const int64_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const uint8_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const uint16_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const uint32_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const uint64_t& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const float& t) -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const double& t) -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+inline auto to_sql_string(context_t& context, const long double& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+// Text literals of other types (e.g. std::string) are serialized as
+// std::string_view.
+inline auto to_sql_string(context_t& context, const std::string_view& t)
+    -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
+// Blob literals of other types (e.g. std::vector) are serialized as
+// std::span.
+inline auto to_sql_string(context_t& context,
+                          const std::span<const uint8_t>& t) -> std::string {
+  return detail::literal_to_sql_string(context, t);
+}
+
 // Some special treatment of data types
 template <typename Period>
 auto to_sql_string(
-    context_t&,
+    context_t& context,
     const std::chrono::time_point<std::chrono::system_clock, Period>& t)
     -> std::string {
-  return std::format("DATETIME('{0:%Y-%m-%d %H:%M:%S}', 'subsec')", t);
+  if (context.date_time_storage() == chrono_storage::integer_epoch) {
+    return detail::literal_to_sql_string(
+        context, static_cast<int64_t>(
+                     std::chrono::floor<std::chrono::microseconds>(t)
+                         .time_since_epoch()
+                         .count()));
+  }
+  auto value = std::string{};
+  ::sqlpp::detail::append_timestamp(value, t);
+  return detail::chrono_to_sql_string(context, "DATETIME", std::move(value),
+                                      ", 'subsec'");
 }
 
-inline auto to_sql_string(context_t&, const std::chrono::microseconds& t)
-    -> std::string {
-  return std::format("TIME('{0:%H:%M:%S}', 'subsec')", t);
+inline auto to_sql_string(context_t& context,
+                          const std::chrono::microseconds& t) -> std::string {
+  if (context.date_time_storage() == chrono_storage::integer_epoch) {
+    return detail::literal_to_sql_string(context,
+                                         static_cast<int64_t>(t.count()));
+  }
+  auto value = std::string{};
+  ::sqlpp::detail::append_time_of_day(value, t);
+  return detail::chrono_to_sql_string(context, "TIME", std::move(value),
+                                      ", 'subsec'");
 }
 
-inline auto to_sql_string(context_t&, const std::chrono::sys_days& t)
+inline auto to_sql_string(context_t& context, const std::chrono::sys_days& t)
     -> std::string {
-  return std::format("DATE('{0:%Y-%m-%d}')", t);
+  if (context.date_time_storage() == chrono_storage::integer_epoch) {
+    return detail::literal_to_sql_string(
+        context, static_cast<int64_t>(t.time_since_epoch().count()));
+  }
+  auto value = std::string{};
+  ::sqlpp::detail::append_date(value, t);
+  return detail::chrono_to_sql_string(context, "DATE", std::move(value), "");
 }
 
 inline auto nan_to_sql_string(context_t&) -> std::string {
@@ -0,0 +1,447 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <sqlpp23/core/aggregate_function/enable_over.h>
+#include <sqlpp23/core/logic.h>
+#include <sqlpp23/core/operator/enable_as.h>
+#include <sqlpp23/core/operator/enable_comparison.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/tuple_to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/wrong.h>
+
+namespace sqlpp::sqlite3 {
+namespace detail {
+// Obtains result and parameter types of non-generic callables and member
+// functions.
+template <typename Callable>
+struct callable_signature
+    : public callable_signature<decltype(&Callable::operator())> {};
+
+template <typename Result, typename... Parameters>
+struct callable_signature<Result (*)(Parameters...)> {
+  using result_type = Result;
+  using parameters = std::tuple<std::decay_t<Parameters>...>;
+
+  // E.g. user_function_t<NameTag, Result, Parameters...>
+  template <template <typename...> class Handle,
+            typename NameTag,
+            typename HandleResult = Result>
+  using handle_t = Handle<NameTag, HandleResult, std::decay_t<Parameters>...>;
+};
+
+template <typename Result, typename... Parameters>
+struct callable_signature<Result (*)(Parameters...) noexcept>
+    : public callable_signature<Result (*)(Parameters...)> {};
+
+template <typename Class, typename Result, typename... Parameters>
+struct callable_signature<Result (Class::*)(Parameters...)>
+    : public callable_signature<Result (*)(Parameters...)> {};
+
+template <typename Class, typename Result, typename... Parameters>
+struct callable_signature<Result (Class::*)(Parameters...) const>
+    : public callable_signature<Result (*)(Parameters...)> {};
+
+template <typename Class, typename Result, typename... Parameters>
+struct callable_signature<Result (Class::*)(Parameters...) noexcept>
+    : public callable_signature<Result (*)(Parameters...)> {};
+
+template <typename Class, typename Result, typename... Parameters>
+struct callable_signature<Result (Class::*)(Parameters...) const noexcept>
+    : public callable_signature<Result (*)(Parameters...)> {};
+
+// NULL is only passed to optional parameters. Otherwise, scalar functions
+// return NULL and aggregates ignore the row, like most SQL functions do.
+template <typename Parameter>
+bool is_unexpected_null(sqlite3_value* value) {
+  return not is_optional<Parameter>::value and
+         sqlite3_value_type(value) == SQLITE_NULL;
+}
+
+// Text and blob views are valid during the call only.
+template <typename Parameter>
+Parameter read_argument(sqlite3_value* value) {
+  if constexpr (is_optional<Parameter>::value) {
+    if (sqlite3_value_type(value) == SQLITE_NULL) {
+      return std::nullopt;
+    }
+    return read_argument<typename Parameter::value_type>(value);
+  } else if constexpr (std::is_same_v<Parameter, bool>) {
+    return sqlite3_value_int64(value) != 0;
+  } else if constexpr (std::is_integral_v<Parameter>) {
+    return static_cast<Parameter>(sqlite3_value_int64(value));
+  } else if constexpr (std::is_floating_point_v<Parameter>) {
+    return static_cast<Parameter>(sqlite3_value_double(value));
+  } else if constexpr (std::is_same_v<Parameter, std::string_view> or
+                       std::is_same_v<Parameter, std::string>) {
+    // sqlite3_value_text must be called before sqlite3_value_bytes.
+    const auto* text =
+        reinterpret_cast<const char*>(sqlite3_value_text(value));
+    return Parameter{text ? text : "",
+                     static_cast<size_t>(sqlite3_value_bytes(value))};
+  } else if constexpr (std::is_same_v<Parameter, std::vector<uint8_t>>) {
+    const auto* data = static_cast<const uint8_t*>(sqlite3_value_blob(value));
+    return Parameter(data, data + sqlite3_value_bytes(value));
+  } else {
+    static_assert(wrong_t<Parameter>::value,
+                  "Sqlite3: unsupported parameter type for user function");
+  }
+}
+
+template <typename Result>
+void set_result(sqlite3_context* context, const Result& result) {
+  if constexpr (std::is_same_v<Result, std::nullopt_t>) {
+    sqlite3_result_null(context);
+  } else if constexpr (is_optional<Result>::value) {
+    if (result.has_value()) {
+      set_result(context, *result);
+    } else {
+      sqlite3_result_null(context);
+    }
+  } else if constexpr (std::is_same_v<Result, bool>) {
+    sqlite3_result_int(context, result ? 1 : 0);
+  } else if constexpr (std::is_integral_v<Result>) {
+    sqlite3_result_int64(context, static_cast<sqlite3_int64>(result));
+  } else if constexpr (std::is_floating_point_v<Result>) {
+    sqlite3_result_double(context, static_cast<double>(result));
+  } else if constexpr (std::is_convertible_v<const Result&, std::string_view>) {
+    const auto text = std::string_view{result};
+    sqlite3_result_text(context, text.data(), static_cast<int>(text.size()),
+                        SQLITE_TRANSIENT);
+  } else if constexpr (std::is_same_v<Result, std::vector<uint8_t>>) {
+    sqlite3_result_blob(context, result.data(),
+                        static_cast<int>(result.size()), SQLITE_TRANSIENT);
+  } else {
+    static_assert(wrong_t<Result>::value,
+                  "Sqlite3: unsupported result type for user function");
+  }
+}
+
+// Exceptions must not pass through SQLite. They are reported as errors of the
+// statement instead.
+template <typename Function>
+void report_exceptions(sqlite3_context* context, Function&& function) {
+  try {
+    function();
+  } catch (const std::exception& e) {
+    sqlite3_result_error(context, e.what(), -1);
+  } catch (...) {
+    sqlite3_result_error(context, "Sqlite3: unknown exception in user function",
+                         -1);
+  }
+}
+
+template <typename Function, typename... Parameters, size_t... Is>
+bool invoke_with_arguments(Function&& function,
+                           sqlite3_value** values,
+                           std::tuple<Parameters...>*,
+                           std::index_sequence<Is...>) {
+  if ((is_unexpected_null<Parameters>(values[Is]) or ...)) {
+    return false;
+  }
+  function(read_argument<Parameters>(values[Is])...);
+  return true;
+}
+
+template <typename Parameters, typename Function>
+bool invoke_with_arguments(Function&& function, sqlite3_value** values) {
+  return invoke_with_arguments(
+      std::forward<Function>(function), values,
+      static_cast<Parameters*>(nullptr),
+      std::make_index_sequence<std::tuple_size_v<Parameters>>{});
+}
+
+template <typename Callable>
+void scalar_function_callback(sqlite3_context* context,
+                              int /*argc*/,
+                              sqlite3_value** values) {
+  using _parameters = typename callable_signature<Callable>::parameters;
+  auto& callable = *static_cast<Callable*>(sqlite3_user_data(context));
+  report_exceptions(context, [&] {
+    const auto called = invoke_with_arguments<_parameters>(
+        [&](auto&&... args) {
+          set_result(context,
+                     std::invoke(callable, std::forward<decltype(args)>(args)...));
+        },
+        values);
+    if (not called) {
+      sqlite3_result_null(context);
+    }
+  });
+}
+
+template <typename Aggregate>
+concept is_window_aggregate = requires(Aggregate& aggregate) {
+  &Aggregate::inverse;
+  aggregate.value();
+};
+
+// The state of an aggregate is created by the first call of step and
+// destroyed by finalize.
+template <typename Aggregate>
+struct aggregate_callbacks {
+  using _parameters =
+      typename callable_signature<decltype(&Aggregate::step)>::parameters;
+
+  static Aggregate* get(sqlite3_context* context, bool create) {
+    auto** state = static_cast<Aggregate**>(
+        sqlite3_aggregate_context(context, create ? sizeof(Aggregate*) : 0));
+    if (not state) {
+      if (create) {
+        throw std::bad_alloc{};
+      }
+      return nullptr;
+    }
+    if (not *state and create) {
+      *state = new Aggregate{};
+    }
+    return *state;
+  }
+
+  static void step(sqlite3_context* context, int, sqlite3_value** values) {
+    report_exceptions(context, [&] {
+      auto* aggregate = get(context, true);
+      invoke_with_arguments<_parameters>(
+          [&](auto&&... args) {
+            aggregate->step(std::forward<decltype(args)>(args)...);
+          },
+          values);
+    });
+  }
+
+  static void inverse(sqlite3_context* context, int, sqlite3_value** values) {
+    report_exceptions(context, [&] {
+      auto* aggregate = get(context, true);
+      invoke_with_arguments<_parameters>(
+          [&](auto&&... args) {
+            aggregate->inverse(std::forward<decltype(args)>(args)...);
+          },
+          values);
+    });
+  }
+
+  static void value(sqlite3_context* context) {
+    report_exceptions(context, [&] {
+      if (auto* aggregate = get(context, false)) {
+        set_result(context, aggregate->value());
+      } else {
+        set_result(context, Aggregate{}.value());
+      }
+    });
+  }
+
+  static void finalize(sqlite3_context* context) {
+    auto* aggregate = get(context, false);
+    report_exceptions(context, [&] {
+      if (aggregate) {
+        set_result(context, aggregate->finalize());
+      } else {
+        set_result(context, Aggregate{}.finalize());
+      }
+    });
+    delete aggregate;
+  }
+};
+}  // namespace detail
+
+// Call of a user defined function in an expression, see
+// connection_base::create_function.
+template <typename NameTag, typename DataType, typename... Args>
+struct user_function_call_t : public enable_as, public enable_comparison {
+  user_function_call_t(Args... args) : _expressions(std::move(args)...) {}
+
+  user_function_call_t(const user_function_call_t&) = default;
+  user_function_call_t(user_function_call_t&&) = default;
+  user_function_call_t& operator=(const user_function_call_t&) = default;
+  user_function_call_t& operator=(user_function_call_t&&) = default;
+  ~user_function_call_t() = default;
+
+ private:
+  friend reader_t;
+  std::tuple<Args...> _expressions;
+};
+
+// Call of a user defined aggregate function in an expression, see
+// connection_base::create_aggregate.
+template <typename NameTag, typename DataType, typename... Args>
+struct user_aggregate_call_t : public enable_as,
+                               public enable_comparison,
+                               public enable_over {
+  user_aggregate_call_t(Args... args) : _expressions(std::move(args)...) {}
+
+  user_aggregate_call_t(const user_aggregate_call_t&) = default;
+  user_aggregate_call_t(user_aggregate_call_t&&) = default;
+  user_aggregate_call_t& operator=(const user_aggregate_call_t&) = default;
+  user_aggregate_call_t& operator=(user_aggregate_call_t&&) = default;
+  ~user_aggregate_call_t() = default;
+
+ private:
+  friend reader_t;
+  std::tuple<Args...> _expressions;
+};
+
+// Typed handle of a user defined function with the given C++ result and
+// parameter types. Calling it with expressions yields an expression.
+template <typename NameTag, typename Result, typename... Parameters>
+struct user_function_t {
+  // NULL arguments for non-optional parameters yield NULL.
+  template <typename... Args>
+  using _data_type_t = std::conditional_t<
+      logic::any<(is_optional<data_type_of_t<Args>>::value and
+                  not is_optional<Parameters>::value)...>::value,
+      force_optional_t<data_type_of_t<Result>>,
+      data_type_of_t<Result>>;
+
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Parameters) and
+             logic::all<values_are_comparable<Parameters, Args>::value...>::
+                 value)
+  auto operator()(Args... args) const
+      -> user_function_call_t<NameTag, _data_type_t<Args...>, Args...> {
+    return {std::move(args)...};
+  }
+};
+
+// Typed handle of a user defined aggregate function with the given C++ result
+// and parameter types. Calling it with expressions yields an aggregate
+// expression.
+template <typename NameTag, typename Result, typename... Parameters>
+struct user_aggregate_t {
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Parameters) and
+             logic::all<values_are_comparable<Parameters, Args>::value...>::
+                 value and
+             not logic::any<contains_aggregate_function<Args>::value...>::value)
+  auto operator()(Args... args) const
+      -> user_aggregate_call_t<NameTag, data_type_of_t<Result>, Args...> {
+    return {std::move(args)...};
+  }
+};
+
+template <typename Context,
+          typename NameTag,
+          typename DataType,
+          typename... Args>
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const user_function_call_t<NameTag, DataType, Args...>& t) -> void {
+  append_name_sql_string(context, out, name_tag_of_t<NameTag>{});
+  out += '(';
+  append_tuple_sql_string(context, out, read.expressions(t),
+                          tuple_operand{", "});
+  out += ')';
+}
+
+template <typename Context,
+          typename NameTag,
+          typename DataType,
+          typename... Args>
+auto to_sql_string(Context& context,
+                   const user_function_call_t<NameTag, DataType, Args...>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
+}
+
+template <typename Context,
+          typename NameTag,
+          typename DataType,
+          typename... Args>
+auto append_sql_string(
+    Context& context,
+    std::string& out,
+    const user_aggregate_call_t<NameTag, DataType, Args...>& t) -> void {
+  append_name_sql_string(context, out, name_tag_of_t<NameTag>{});
+  out += '(';
+  append_tuple_sql_string(context, out, read.expressions(t),
+                          tuple_operand{", "});
+  out += ')';
+}
+
+template <typename Context,
+          typename NameTag,
+          typename DataType,
+          typename... Args>
+auto to_sql_string(Context& context,
+                   const user_aggregate_call_t<NameTag, DataType, Args...>& t)
+    -> std::string {
+  auto result = std::string{};
+  append_sql_string(context, result, t);
+  return result;
+}
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp {
+template <typename NameTag, typename DataType, typename... Args>
+struct data_type_of<sqlite3::user_function_call_t<NameTag, DataType, Args...>> {
+  using type = DataType;
+};
+
+template <typename NameTag, typename DataType, typename... Args>
+struct nodes_of<sqlite3::user_function_call_t<NameTag, DataType, Args...>> {
+  using type = detail::type_vector<Args...>;
+};
+
+template <typename NameTag, typename DataType, typename... Args>
+struct data_type_of<sqlite3::user_aggregate_call_t<NameTag, DataType, Args...>> {
+  using type = DataType;
+};
+
+template <typename NameTag, typename DataType, typename... Args>
+struct nodes_of<sqlite3::user_aggregate_call_t<NameTag, DataType, Args...>> {
+  using type = detail::type_vector<Args...>;
+};
+
+template <typename NameTag, typename DataType, typename... Args>
+struct is_aggregate_function<
+    sqlite3::user_aggregate_call_t<NameTag, DataType, Args...>>
+    : public std::true_type {};
+}  // namespace sqlpp
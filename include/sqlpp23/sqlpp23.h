@@ -43,3 +43,4 @@
 #include <sqlpp23/core/function.h>
 #include <sqlpp23/core/name/create_name_tag.h>
 #include <sqlpp23/core/operator.h>
+#include <sqlpp23/core/query/static_sql.h>
@@ -30,6 +30,7 @@ module;
 #include <sqlpp23/sqlpp23.h>
 #include <sqlpp23/core/database/connection_pool.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/value_codec.h>
 export module sqlpp23.core;
 
 export namespace sqlpp {
@@ -235,6 +236,7 @@ using ::sqlpp::upper;
 // database
 using ::sqlpp::bind_parameter;
 using ::sqlpp::read_field;
+using ::sqlpp::read_into;
 using ::sqlpp::bind_field;
 using ::sqlpp::isolation_level;
 using ::sqlpp::start_transaction;
@@ -242,6 +244,8 @@ using ::sqlpp::exception;
 using ::sqlpp::connection_check;
 using ::sqlpp::normal_connection;
 using ::sqlpp::pooled_connection;
+using ::sqlpp::prepared_statement_cache_stats;
+using ::sqlpp::prepared_statement_cache_entry;
 
 // query
 using ::sqlpp::dynamic;
@@ -249,6 +253,9 @@ using ::sqlpp::dynamic_t;
 
 // serialization
 using ::sqlpp::to_sql_string;
+using ::sqlpp::append_sql_string;
+using ::sqlpp::static_sql_string;
+using ::sqlpp::statement_sql_string;
 
 // logging
 using ::sqlpp::log_category;
@@ -313,6 +320,8 @@ using ::sqlpp::is_blob;
 using ::sqlpp::is_boolean;
 using ::sqlpp::is_date;
 using ::sqlpp::nodes_of_t;
+using ::sqlpp::has_static_sql;
+using ::sqlpp::has_static_sql_nodes;
 using ::sqlpp::select_column_has_name;
 using ::sqlpp::has_enabled_over;
 using ::sqlpp::has_enabled_comparison;
@@ -410,6 +419,11 @@ using ::sqlpp::detail::circular_buffer;
 using ::sqlpp::detail::parse_date;
 using ::sqlpp::detail::parse_time;
 using ::sqlpp::detail::parse_timestamp;
+using ::sqlpp::detail::number_to_string;
+using ::sqlpp::detail::parse_number;
+using ::sqlpp::detail::append_date;
+using ::sqlpp::detail::append_time_of_day;
+using ::sqlpp::detail::append_timestamp;
 using ::sqlpp::detail::type_set;
 using ::sqlpp::detail::type_vector;
 using ::sqlpp::detail::get_last_if_t;
@@ -40,8 +40,13 @@ using ::sqlpp::mysql::connection_config;
 using ::sqlpp::mysql::connection_pool;
 using ::sqlpp::mysql::pooled_connection;
 using ::sqlpp::mysql::context_t;
+using ::sqlpp::mysql::prepare_options;
+#ifdef SQLPP_USE_MARIADB
+using ::sqlpp::mysql::async_query_t;
+#endif
 
 using ::sqlpp::mysql::command_result;
+using ::sqlpp::mysql::load_data_result;
 using ::sqlpp::mysql::exception;
 
 using ::sqlpp::mysql::scoped_library_initializer_t;
@@ -54,6 +59,11 @@ using ::sqlpp::mysql::assert_no_bool_cast;
 using ::sqlpp::mysql::assert_no_full_outer_join_t;
 
 using ::sqlpp::mysql::to_sql_string;
+using ::sqlpp::mysql::append_sql_string;
 using ::sqlpp::mysql::quoted_name_to_sql_string;
 using ::sqlpp::mysql::data_type_to_sql_string;
 }
+
+export namespace sqlpp::mysql::detail {
+using ::sqlpp::mysql::detail::literal_parameter;
+}
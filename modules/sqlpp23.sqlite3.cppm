@@ -36,11 +36,23 @@ using ::sqlpp::sqlite3::bind_parameter;
 using ::sqlpp::sqlite3::read_field;
 using ::sqlpp::sqlite3::connection;
 using ::sqlpp::sqlite3::connection_config;
+using ::sqlpp::sqlite3::chrono_storage;
 using ::sqlpp::sqlite3::connection_pool;
 using ::sqlpp::sqlite3::pooled_connection;
+using ::sqlpp::sqlite3::wal_pool;
+using ::sqlpp::sqlite3::blob_handle;
+using ::sqlpp::sqlite3::blob_mode;
+using ::sqlpp::sqlite3::backup_t;
+using ::sqlpp::sqlite3::backup_progress;
+using ::sqlpp::sqlite3::statement_status;
+using ::sqlpp::sqlite3::scan_status;
+using ::sqlpp::sqlite3::row_change;
+using ::sqlpp::sqlite3::change_operation;
+using ::sqlpp::sqlite3::load_snapshot;
 using ::sqlpp::sqlite3::context_t;
 
 using ::sqlpp::sqlite3::command_result;
+using ::sqlpp::sqlite3::statement_cache_stats;
 using ::sqlpp::sqlite3::exception;
 
 using ::sqlpp::sqlite3::delete_from;
@@ -49,11 +61,22 @@ using ::sqlpp::sqlite3::insert_into;
 using ::sqlpp::sqlite3::insert_or_replace;
 using ::sqlpp::sqlite3::insert_or_ignore;
 
+using ::sqlpp::sqlite3::user_function_t;
+using ::sqlpp::sqlite3::user_aggregate_t;
+using ::sqlpp::sqlite3::carray_parameter;
+using ::sqlpp::sqlite3::carray_parameter_t;
+using ::sqlpp::sqlite3::zeroblob;
+
 using ::sqlpp::sqlite3::assert_no_cast_to_date_time;
 using ::sqlpp::sqlite3::assert_no_any_t;
 
 using ::sqlpp::sqlite3::to_sql_string;
+using ::sqlpp::sqlite3::append_sql_string;
 using ::sqlpp::sqlite3::nan_to_sql_string;
 using ::sqlpp::sqlite3::inf_to_sql_string;
 using ::sqlpp::sqlite3::neg_inf_to_sql_string;
 }
+
+export namespace sqlpp::sqlite3::detail {
+using ::sqlpp::sqlite3::detail::literal_parameter;
+}
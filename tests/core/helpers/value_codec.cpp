@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2023, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/value_codec.h>
+#include <sqlpp23/tests/core/all.h>
+
+// Round-trip tests with random values: Everything that is formatted by the
+// value codec has to be parsed back into the original value, and the formatted
+// text has to be identical to what std::format produced before.
+namespace sqlpp {
+namespace {
+constexpr size_t iterations = 100'000;
+
+template <typename Result, typename Expected>
+void assert_equal(int lineNo, const Result& result, const Expected& expected) {
+  if (result != expected) {
+    std::cerr << __FILE__ << " " << lineNo << '\n'
+              << "Expected: -->|" << expected << "|<--\n"
+              << "Received: -->|" << result << "|<--\n";
+    throw std::runtime_error("unexpected result");
+  }
+}
+
+template <typename Result>
+inline void assert_true(int lineNo, Result result) {
+  assert_equal(lineNo, result, true);
+}
+
+template <typename T>
+void test_integral(std::mt19937_64& generator) {
+  auto distribution = std::uniform_int_distribution<T>{
+      std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+  for (size_t i = 0; i < iterations; ++i) {
+    const auto value = distribution(generator);
+    const auto text = detail::number_to_string(value);
+    assert_equal(__LINE__, text, std::format("{}", value));
+
+    auto parsed = T{};
+    assert_true(__LINE__, detail::parse_number(text, parsed));
+    assert_equal(__LINE__, parsed, value);
+  }
+
+  for (const auto value :
+       {T{0}, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()}) {
+    auto parsed = T{};
+    assert_true(__LINE__,
+                detail::parse_number(detail::number_to_string(value), parsed));
+    assert_equal(__LINE__, parsed, value);
+  }
+}
+
+template <typename T, typename Bits>
+void test_floating_point(std::mt19937_64& generator) {
+  // Random bit patterns cover the whole range of exponents.
+  auto distribution = std::uniform_int_distribution<Bits>{};
+  for (size_t i = 0; i < iterations; ++i) {
+    const auto value = std::bit_cast<T>(distribution(generator));
+    // Denormals have less than digits10 significant digits.
+    if (not std::isnormal(value) and value != T{0}) {
+      continue;
+    }
+    const auto text = detail::number_to_string(value);
+    assert_equal(__LINE__, text,
+                 std::format("{:.{}g}", value, std::numeric_limits<T>::digits10));
+
+    // digits10 does not suffice for an exact round trip, but formatting the
+    // parsed value has to be stable.
+    auto parsed = T{};
+    assert_true(__LINE__, detail::parse_number(text, parsed));
+    assert_equal(__LINE__, detail::number_to_string(parsed), text);
+  }
+}
+
+void test_date(std::mt19937_64& generator) {
+  // Roughly -0200-01-01 to 10199-12-31, i.e. years from 0000 to 9999 (fast
+  // path) plus some years beyond (fallback).
+  auto distribution = std::uniform_int_distribution<int>{-792'576, 3'005'943};
+  for (size_t i = 0; i < iterations; ++i) {
+    const auto value =
+        std::chrono::sys_days{std::chrono::days{distribution(generator)}};
+    auto text = std::string{};
+    detail::append_date(text, value);
+    assert_equal(__LINE__, text, std::format("{0:%Y-%m-%d}", value));
+
+    auto parsed = std::chrono::sys_days{};
+    auto input = text.c_str();
+    const auto year =
+        static_cast<int>(std::chrono::year_month_day{value}.year());
+    if (year >= 0 and year <= 9999) {
+      assert_true(__LINE__, detail::parse_date(parsed, input));
+      assert_true(__LINE__, parsed == value);
+    }
+  }
+}
+
+void test_time_of_day(std::mt19937_64& generator) {
+  auto distribution = std::uniform_int_distribution<int64_t>{
+      0, std::chrono::microseconds{std::chrono::days{1}}.count() - 1};
+  for (size_t i = 0; i < iterations; ++i) {
+    const auto value = std::chrono::microseconds{distribution(generator)};
+    auto text = std::string{};
+    detail::append_time_of_day(text, value);
+    assert_equal(__LINE__, text, std::format("{0:%H:%M:%S}", value));
+
+    auto parsed = std::chrono::microseconds{};
+    auto input = text.c_str();
+    assert_true(__LINE__, detail::parse_time(parsed, input));
+    assert_equal(__LINE__, parsed.count(), value.count());
+
+    // Coarser durations are formatted without fractional digits.
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(value);
+    text.clear();
+    detail::append_time_of_day(text, seconds);
+    assert_equal(__LINE__, text, std::format("{0:%H:%M:%S}", seconds));
+  }
+}
+
+void test_timestamp(std::mt19937_64& generator) {
+  // 0000-01-01 00:00:00 to 9999-12-31 23:59:59.999999
+  auto distribution = std::uniform_int_distribution<int64_t>{
+      -62'167'219'200'000'000, 253'402'300'799'999'999};
+  for (size_t i = 0; i < iterations; ++i) {
+    const auto value = ::sqlpp::chrono::sys_microseconds{
+        std::chrono::microseconds{distribution(generator)}};
+    auto text = std::string{};
+    detail::append_timestamp(text, value);
+    assert_equal(__LINE__, text, std::format("{0:%Y-%m-%d %H:%M:%S}", value));
+
+    auto parsed = ::sqlpp::chrono::sys_microseconds{};
+    auto input = text.c_str();
+    assert_true(__LINE__, detail::parse_timestamp(parsed, input));
+    assert_true(__LINE__, parsed == value);
+
+    text.clear();
+    detail::append_timestamp(text, value, 'T');
+    assert_equal(__LINE__, text, std::format("{0:%Y-%m-%dT%H:%M:%S}", value));
+  }
+}
+
+void test_invalid_input() {
+  auto integral = int64_t{17};
+  assert_equal(__LINE__, detail::parse_number("", integral), false);
+  assert_equal(__LINE__, integral, int64_t{0});
+
+  auto floating_point = double{17};
+  assert_equal(__LINE__, detail::parse_number("abc", floating_point), false);
+  assert_equal(__LINE__, floating_point, 0.0);
+
+  // Like std::strtoull, negative numbers wrap around for unsigned types.
+  auto unsigned_integral = uint64_t{17};
+  assert_true(__LINE__, detail::parse_number("-1", unsigned_integral));
+  assert_equal(__LINE__, unsigned_integral,
+               std::numeric_limits<uint64_t>::max());
+  assert_equal(__LINE__, detail::parse_number("--1", unsigned_integral), false);
+  assert_equal(__LINE__, unsigned_integral, uint64_t{0});
+
+  // Like std::strtoll, numbers out of range are clamped.
+  assert_equal(__LINE__, detail::parse_number("99999999999999999999", integral),
+               false);
+  assert_equal(__LINE__, integral, std::numeric_limits<int64_t>::max());
+  assert_equal(__LINE__,
+               detail::parse_number("-99999999999999999999", integral), false);
+  assert_equal(__LINE__, integral, std::numeric_limits<int64_t>::min());
+  assert_equal(__LINE__, detail::parse_number("1e999", floating_point), false);
+  assert_equal(__LINE__, floating_point,
+               std::numeric_limits<double>::infinity());
+  assert_equal(__LINE__, detail::parse_number("1e-999", floating_point), false);
+  assert_equal(__LINE__, floating_point, 0.0);
+
+  // Leading whitespace and `+` are skipped, trailing characters are ignored.
+  assert_true(__LINE__, detail::parse_number(" \t+17", integral));
+  assert_equal(__LINE__, integral, int64_t{17});
+  assert_true(__LINE__, detail::parse_number(" +0.5", floating_point));
+  assert_equal(__LINE__, floating_point, 0.5);
+  assert_true(__LINE__, detail::parse_number("17 apples", integral));
+  assert_equal(__LINE__, integral, int64_t{17});
+  assert_equal(__LINE__, detail::parse_number("+-17", integral), false);
+  assert_equal(__LINE__, integral, int64_t{0});
+
+  // Special values as reported by PostgreSQL.
+  assert_true(__LINE__, detail::parse_number("-Infinity", floating_point));
+  assert_equal(__LINE__, floating_point,
+               -std::numeric_limits<double>::infinity());
+}
+
+}  // namespace
+}  // namespace sqlpp
+
+int main(int, char*[]) {
+  // Fixed seed for reproducible failures.
+  auto generator = std::mt19937_64{20251017};
+
+  sqlpp::test_integral<int64_t>(generator);
+  sqlpp::test_integral<uint64_t>(generator);
+  sqlpp::test_integral<int32_t>(generator);
+  sqlpp::test_floating_point<double, uint64_t>(generator);
+  sqlpp::test_floating_point<float, uint32_t>(generator);
+  sqlpp::test_date(generator);
+  sqlpp::test_time_of_day(generator);
+  sqlpp::test_timestamp(generator);
+  sqlpp::test_invalid_input();
+
+  return 0;
+}
@@ -379,6 +379,12 @@ int main(int, char*[]) {
 
     SQLPP_COMPARE(val or dynamic(true, val) or expr, "1 OR 1 OR (17 > 15)");
     SQLPP_COMPARE(val or dynamic(false, val) or expr, "1 OR (17 > 15)");
+    SQLPP_COMPARE(val and dynamic(true, val) and dynamic(true, expr),
+                  "1 AND 1 AND (17 > 15)");
+    SQLPP_COMPARE(val and dynamic(true, val) and dynamic(false, expr),
+                  "1 AND 1");
+    SQLPP_COMPARE(val and dynamic(false, val) and dynamic(true, expr),
+                  "1 AND (17 > 15)");
 
     // More complex expressions
     SQLPP_COMPARE((val and dynamic(true, expr)) or dynamic(true, val),
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/core/allocation_counter.h>
+#include <sqlpp23/tests/core/all.h>
+
+int main() {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  const auto statement =
+      sqlpp::select(foo.id, bar.intN)
+          .from(foo.join(bar).on(foo.id == bar.id))
+          .where(foo.id > 17 and bar.intN.in(1, 2, 3))
+          .order_by(foo.id.asc())
+          .limit(10);
+
+  sqlpp::mock_db::context_t context;
+  const auto expected = to_sql_string(context, statement);
+
+  // Appending keeps the existing content of the buffer.
+  auto buffer = std::string{"-- "};
+  append_sql_string(context, buffer, statement);
+  if (buffer != "-- " + expected) {
+    std::cerr << "Expected: -->|-- " << expected << "|<--\n"
+              << "Received: -->|" << buffer << "|<--\n";
+    return 1;
+  }
+
+  // Serializing into a buffer with sufficient capacity does not allocate.
+  buffer.clear();
+  {
+    const auto counter = sqlpp::test::allocation_counter{};
+    append_sql_string(context, buffer, statement);
+    if (counter.allocations() != 0) {
+      std::cerr << "Unexpected allocations: " << counter.allocations() << '\n';
+      return 1;
+    }
+  }
+  if (buffer != expected) {
+    std::cerr << "Expected: -->|" << expected << "|<--\n"
+              << "Received: -->|" << buffer << "|<--\n";
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/core/all.h>
+
+namespace {
+// Empty, but not known to sqlpp23.
+struct custom_t {};
+}  // namespace
+
+int main() {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  // Statements that only depend on their type.
+  static_assert(sqlpp::has_static_sql<decltype(sqlpp::select(foo.id))>::value);
+  static_assert(sqlpp::has_static_sql<decltype(
+                    sqlpp::select(foo.id, bar.intN)
+                        .from(foo.join(bar).on(foo.id == bar.id))
+                        .where(foo.id > parameter(foo.id)))>::value);
+  static_assert(sqlpp::has_static_sql<decltype(
+                    sqlpp::update(foo)
+                        .set(foo.intN = parameter(foo.intN))
+                        .where(foo.id == parameter(foo.id)))>::value);
+  static_assert(sqlpp::has_static_sql<decltype(
+                    sqlpp::delete_from(foo).where(foo.id ==
+                                                  parameter(foo.id)))>::value);
+  static_assert(sqlpp::has_static_sql<decltype(
+                    sqlpp::select(sqlpp::count(foo.id).as(sqlpp::alias::a))
+                        .from(foo)
+                        .where(foo.intN.is_null()))>::value);
+
+  // Statements with values, dynamic parts or runtime sizes.
+  static_assert(not sqlpp::has_static_sql<decltype(
+                    sqlpp::select(foo.id).from(foo).where(foo.id >
+                                                          17))>::value);
+  static_assert(not sqlpp::has_static_sql<decltype(
+                    sqlpp::select(foo.id).from(foo).where(
+                        dynamic(true, foo.id > foo.intN)))>::value);
+  static_assert(not sqlpp::has_static_sql<decltype(
+                    sqlpp::select(foo.id).from(foo).where(
+                        dynamic(true, foo.id > parameter(foo.id))))>::value);
+  static_assert(not sqlpp::has_static_sql<decltype(
+                    sqlpp::select(foo.id).from(foo).order_by(
+                        foo.id.asc()))>::value);
+  static_assert(not sqlpp::has_static_sql<decltype(
+                    sqlpp::select(foo.id).from(foo).where(
+                        foo.id.in(std::vector<int64_t>{})))>::value);
+  static_assert(not sqlpp::has_static_sql<decltype(
+                    sqlpp::select(foo.id).from(foo).limit(10))>::value);
+
+  // Nodes that did not opt in, e.g. custom functions.
+  static_assert(not sqlpp::has_static_sql<custom_t>::value);
+  static_assert(not sqlpp::has_static_sql<
+                decltype(sqlpp::select(foo.id).from(foo).where(
+                    sqlpp::verbatim<sqlpp::boolean>("id > 17")))>::value);
+
+  // Static SQL is serialized once and then re-used.
+  const auto statement = sqlpp::select(foo.id, bar.intN)
+                             .from(foo.join(bar).on(foo.id == bar.id))
+                             .where(foo.id > parameter(foo.id));
+
+  sqlpp::mock_db::context_t context;
+  const auto expected = to_sql_string(context, statement);
+  const auto& sql = sqlpp::static_sql_string(context, statement);
+  if (sql != expected) {
+    std::cerr << "Expected: -->|" << expected << "|<--\n"
+              << "Received: -->|" << sql << "|<--\n";
+    return 1;
+  }
+
+  if (&sqlpp::static_sql_string(context, statement) != &sql) {
+    std::cerr << "Static SQL was serialized again\n";
+    return 1;
+  }
+
+  auto buffer = std::string{};
+  if (&sqlpp::statement_sql_string(context, statement, buffer) != &sql or
+      not buffer.empty()) {
+    std::cerr << "Static SQL was not re-used\n";
+    return 1;
+  }
+
+  // Other statements are serialized into the buffer.
+  const auto dynamic_statement =
+      sqlpp::select(foo.id).from(foo).where(foo.id > 17);
+  if (&sqlpp::statement_sql_string(context, dynamic_statement, buffer) !=
+          &buffer or
+      buffer != to_sql_string(context, dynamic_statement)) {
+    std::cerr << "Unexpected SQL: -->|" << buffer << "|<--\n";
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Checks that re-executing prepared statements does not allocate, for any
+// connector. Includes allocation_counter.h, i.e. this header must only be
+// included by a single translation unit.
+
+#include <sqlpp23/tests/core/allocation_counter.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sqlpp23/sqlpp23.h>
+
+namespace sqlpp::test {
+// `foo` and `date_time` are the connector's test::TabFoo and
+// test::TabDateTime, which must exist in the database. `db` must not log,
+// since logging allocates. Returns 0 on success.
+template <typename Db, typename TabFoo, typename TabDateTime>
+int check_prepared_allocations(Db& db,
+                               const TabFoo& foo,
+                               const TabDateTime& date_time) {
+  auto prepared_foo = db.prepare(sqlpp::insert_into(foo).set(
+      foo.textNnD = sqlpp::parameter(foo.textNnD),
+      foo.intN = sqlpp::parameter(foo.intN),
+      foo.doubleN = sqlpp::parameter(foo.doubleN),
+      foo.boolN = sqlpp::parameter(foo.boolN),
+      foo.blobN = sqlpp::parameter(foo.blobN)));
+
+  auto prepared_date_time = db.prepare(sqlpp::insert_into(date_time).set(
+      date_time.dateN = sqlpp::parameter(date_time.dateN),
+      date_time.timestampN = sqlpp::parameter(date_time.timestampN),
+      date_time.timeN = sqlpp::parameter(date_time.timeN)));
+
+  const auto text = std::string{"a text that does not fit into SSO buffers"};
+  const auto blob = std::vector<uint8_t>{'b', 'l', 'o', 'b', 0, 1, 2, 3};
+  const auto now = std::chrono::floor<std::chrono::microseconds>(
+      std::chrono::system_clock::now());
+
+  const auto execute = [&](int64_t i) {
+    prepared_foo.parameters.textNnD = text;
+    prepared_foo.parameters.intN = i;
+    prepared_foo.parameters.doubleN = static_cast<double>(i) / 3.0;
+    prepared_foo.parameters.boolN = (i % 2 == 0);
+    prepared_foo.parameters.blobN = blob;
+    db(prepared_foo);
+
+    prepared_date_time.parameters.dateN =
+        std::chrono::floor<std::chrono::days>(now);
+    prepared_date_time.parameters.timestampN = now;
+    prepared_date_time.parameters.timeN =
+        std::chrono::hours{10} + std::chrono::microseconds{i};
+    db(prepared_date_time);
+  };
+
+  // The first execution may allocate, e.g. to size parameter buffers.
+  execute(0);
+
+  const auto counter = allocation_counter{};
+  for (int64_t i = 1; i < 100; ++i) {
+    execute(i);
+  }
+  if (counter.allocations() != 0) {
+    std::cerr << "Unexpected allocations when re-executing prepared "
+                 "statements: "
+              << counter.allocations() << std::endl;
+    return 1;
+  }
+  return 0;
+}
+}  // namespace sqlpp::test
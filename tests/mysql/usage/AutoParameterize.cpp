@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <algorithm>
+
+#include <sqlpp23/tests/mysql/all.h>
+
+namespace sql = sqlpp::mysql;
+
+int AutoParameterize(int, char*[]) {
+  sql::global_library_init();
+  try {
+    auto config = sql::make_test_config();
+    config->auto_parameterize = true;
+    sql::connection db;
+    db.connect_using(config);
+
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    // Literals are replaced by parameters.
+    {
+      sql::context_t context{&db};
+      auto literals = std::vector<sql::detail::literal_parameter>{};
+      context._literals = &literals;
+      require_equal(__LINE__,
+                    to_sql_string(context, tab.intN == 7 and
+                                               tab.textNnD == "it's"),
+                    std::string{"(tab_foo.int_n = ?) AND "
+                                "(tab_foo.text_nn_d = ?)"});
+      require_equal(__LINE__, literals.size(), size_t{2});
+      require_equal(__LINE__, std::get<int64_t>(literals[0]), int64_t{7});
+      require_equal(__LINE__, std::get<std::string>(literals[1]),
+                    std::string{"it's"});
+    }
+
+    // Values arrive in the database unchanged.
+    for (int i = 0; i < 3; ++i) {
+      const auto result = db(insert_into(tab).set(
+          tab.textNnD = "it's " + std::to_string(i), tab.intN = i,
+          tab.doubleN = 0.5 * i, tab.uIntN = uint64_t{1} << 63,
+          tab.boolN = (i % 2 == 0)));
+      require_equal(__LINE__, result.affected_rows, uint64_t{1});
+      require_equal(__LINE__, result.last_insert_id == 0, false);
+    }
+    // Selects are executed with inline literals.
+    for (int i = 0; i < 3; ++i) {
+      auto result =
+          db(select(tab.textNnD, tab.doubleN, tab.uIntN, tab.boolN)
+                 .from(tab)
+                 .where(tab.intN == i));
+      const auto& row = result.front();
+      require_equal(__LINE__, row.textNnD, "it's " + std::to_string(i));
+      require_equal(__LINE__, row.doubleN.value(), 0.5 * i);
+      require_equal(__LINE__, row.uIntN.value(), uint64_t{1} << 63);
+      require_equal(__LINE__, row.boolN.value(), (i % 2 == 0));
+    }
+    require_equal(__LINE__,
+                  db(update(tab).set(tab.doubleN = 1.5).where(tab.intN > 0))
+                      .affected_rows,
+                  uint64_t{2});
+    require_equal(__LINE__,
+                  db(delete_from(tab).where(tab.intN == 2)).affected_rows,
+                  uint64_t{1});
+
+    // Blobs are serialized inline.
+    const auto blob = std::vector<uint8_t>{0, 1, 2, 0, 255};
+    db(insert_into(tab).set(tab.intN = 3, tab.blobN = blob));
+    auto blob_result = db(select(tab.blobN).from(tab).where(tab.intN == 3));
+    if (not std::ranges::equal(blob_result.front().blobN.value(), blob)) {
+      throw std::runtime_error("Unexpected blob");
+    }
+
+    // Dates and timestamps are bound as MYSQL_TIME.
+    const auto tab_dt = test::TabDateTime{};
+    test::createTabDateTime(db);
+    const auto now = std::chrono::floor<std::chrono::milliseconds>(
+        std::chrono::system_clock::now());
+    const auto today = std::chrono::floor<std::chrono::days>(now);
+    db(insert_into(tab_dt).set(tab_dt.dateN = today, tab_dt.timestampN = now));
+    auto result = db(select(tab_dt.dateN, tab_dt.timestampN)
+                         .from(tab_dt)
+                         .where(tab_dt.dateN == today));
+    const auto& row = result.front();
+    require_equal(__LINE__, row.dateN.value(), today);
+    require_equal(__LINE__, row.timestampN.value(), now);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/mysql/all.h>
+
+namespace {
+const auto library_raii =
+    sqlpp::mysql::scoped_library_initializer_t{0, nullptr, nullptr};
+
+namespace sql = sqlpp::mysql;
+SQLPP_CREATE_NAME_TAG(local_infile);
+const auto foo = test::TabFoo{};
+const auto bar = test::TabBar{};
+}  // namespace
+
+void testLoadData(sql::connection& db) {
+  db(truncate(foo));
+
+  using row_t = std::tuple<std::string, std::optional<int64_t>,
+                           std::optional<double>, std::optional<bool>,
+                           std::optional<std::vector<uint8_t>>>;
+  const auto rows = std::vector<row_t>{
+      {"plain", 1, 1.5, true, std::vector<uint8_t>{0, 1, 2}},
+      {"tab\tnewline\nbackslash\\quote'", std::nullopt, std::nullopt,
+       std::nullopt, std::nullopt},
+      {"\\N", -3, -0.25, false, std::vector<uint8_t>{'\t', '\n', '\\', 0}},
+  };
+
+  const auto result = db.load_data(
+      foo, std::make_tuple(foo.textNnD, foo.intN, foo.doubleN, foo.boolN,
+                           foo.blobN),
+      rows);
+  assert(result.affected_rows == rows.size());
+  assert(result.warning_count == 0);
+  assert(result.warnings.empty());
+
+  auto index = size_t{0};
+  for (const auto& row :
+       db(select(foo.textNnD, foo.intN, foo.doubleN, foo.boolN, foo.blobN)
+              .from(foo)
+              .where(true)
+              .order_by(foo.id.asc()))) {
+    const auto& expected = rows.at(index++);
+    assert(row.textNnD == std::get<0>(expected));
+    assert(row.intN == std::get<1>(expected));
+    assert(row.doubleN == std::get<2>(expected));
+    assert(row.boolN == std::get<3>(expected));
+    assert(row.blobN.has_value() == std::get<4>(expected).has_value());
+    if (row.blobN.has_value()) {
+      assert(std::ranges::equal(row.blobN.value(),
+                                std::get<4>(expected).value()));
+    }
+  }
+  assert(index == rows.size());
+}
+
+void testLoadDataWarnings(sql::connection& db) {
+  db(truncate(bar));
+
+  // int_n is a 32 bit column, the value gets clamped
+  const auto rows = std::vector<std::tuple<int64_t>>{{int64_t{1} << 40}};
+  const auto result = db.load_data(bar, std::make_tuple(bar.intN), rows);
+  assert(result.affected_rows == 1);
+  assert(result.warning_count > 0);
+  assert(not result.warnings.empty());
+}
+
+int LoadData(int, char*[]) {
+  sql::global_library_init();
+  try {
+    auto config = sql::make_test_config();
+    config->local_infile = true;
+    sql::connection db;
+    db.connect_using(config);
+    // The server has to accept LOAD DATA LOCAL, too
+    const auto server_local_infile =
+        db(select(sqlpp::verbatim<sqlpp::integral>("@@local_infile")
+                      .as(local_infile)))
+            .front()
+            .local_infile;
+    if (server_local_infile.value_or(0) == 0) {
+      std::cerr << "Warning: not testing LoadData, because local_infile is "
+                   "disabled on the server"
+                << std::endl;
+      return 0;
+    }
+
+    test::createTabFoo(db);
+    test::createTabBar(db);
+
+    testLoadData(db);
+    testLoadDataWarnings(db);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
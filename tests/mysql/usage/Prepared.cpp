@@ -63,6 +63,103 @@ void testPreparedStatementResult(sql::connection& db) {
   db(preparedUpdateAll);
 }
 
+void testPreparedStatementCursor(sql::connection& db) {
+  db(truncate(tab));
+  auto preparedInsert =
+      db.prepare(insert_into(tab).set(tab.intN = parameter(tab.intN)));
+  for (int64_t i = 0; i < 10; ++i) {
+    preparedInsert.parameters.intN = i;
+    db(preparedInsert);
+  }
+
+  auto preparedSelect = db.prepare(
+      sqlpp::select(tab.intN).from(tab).where(tab.intN >= parameter(tab.intN)),
+      sql::prepare_options{.read_only_cursor = true, .prefetch_rows = 3});
+
+  // Execute twice to make sure that the cursor is re-opened
+  for (int run = 0; run < 2; ++run) {
+    preparedSelect.parameters.intN = 2;
+    int64_t count = 0;
+    for (const auto& row : db(preparedSelect)) {
+      assert(row.intN.has_value());
+      assert(row.intN.value() >= 2);
+      ++count;
+    }
+    assert(count == 8);
+  }
+}
+
+void testPreparedStatementBulk(sql::connection& db) {
+  db(truncate(tab));
+  auto preparedInsert =
+      db.prepare(insert_into(tab).set(tab.textN = parameter(tab.textN),
+                                      tab.intN = parameter(tab.intN)));
+
+  auto rows = std::vector<std::tuple<std::optional<std::string>, int64_t>>{};
+  for (int64_t i = 0; i < 10; ++i) {
+    auto text = i % 3 == 0 ? std::nullopt
+                           : std::optional<std::string>{std::to_string(i)};
+    rows.emplace_back(std::move(text), i);
+  }
+  // Use a chunk size that does not divide the number of rows
+  const auto inserted = db.bulk_execute(preparedInsert, rows, 4);
+  assert(inserted.affected_rows == 10);
+
+  for (const auto& row :
+       db(sqlpp::select(tab.textN, tab.intN).from(tab).where(true))) {
+    assert(row.intN.has_value());
+    if (row.intN.value() % 3 == 0) {
+      assert(not row.textN.has_value());
+    } else {
+      assert(row.textN == std::to_string(row.intN.value()));
+    }
+  }
+
+  auto preparedUpdate = db.prepare(sqlpp::update(tab)
+                                       .set(tab.boolNn = parameter(tab.boolNn))
+                                       .where(tab.intN == parameter(tab.intN)));
+  const auto updated = db.bulk_execute(
+      preparedUpdate, std::vector<std::tuple<bool, int64_t>>{
+                          {true, 1}, {true, 2}, {true, 42}});
+  assert(updated.affected_rows == 2);
+
+  // Parameters in inactive dynamic parts are not bound, their values are
+  // ignored. Parameters after them are bound at their actual positions.
+  auto preparedInactiveUpdate = db.prepare(
+      sqlpp::update(tab)
+          .set(tab.boolNn = parameter(tab.boolNn))
+          .where(tab.id > 0 and
+                 dynamic(false, tab.textN == parameter(tab.textN)) and
+                 tab.intN == parameter(tab.intN)));
+  const auto updatedInactive = db.bulk_execute(
+      preparedInactiveUpdate,
+      std::vector<std::tuple<bool, std::optional<std::string>, int64_t>>{
+          {true, "ignored", 4}, {true, std::nullopt, 5}});
+  assert(updatedInactive.affected_rows == 2);
+
+  // Parameters in active dynamic parts are bound as usual.
+  auto preparedActiveUpdate = db.prepare(
+      sqlpp::update(tab)
+          .set(tab.boolNn = parameter(tab.boolNn))
+          .where(tab.id > 0 and
+                 dynamic(true, tab.textN == parameter(tab.textN)) and
+                 tab.intN == parameter(tab.intN)));
+  const auto updatedActive = db.bulk_execute(
+      preparedActiveUpdate,
+      std::vector<std::tuple<bool, std::optional<std::string>, int64_t>>{
+          {true, "7", 7}, {true, "wrong", 8}});
+  assert(updatedActive.affected_rows == 1);
+
+  // Regular execution still works after bulk execution
+  preparedInsert.parameters.textN = "single";
+  preparedInsert.parameters.intN = 11;
+  db(preparedInsert);
+  for (const auto& row :
+       db(sqlpp::select(count(tab.id).as(something)).from(tab).where(true))) {
+    assert(row.something == 11);
+  }
+}
+
 int Prepared(int, char*[]) {
   sql::global_library_init();
   try {
@@ -70,6 +167,8 @@ int Prepared(int, char*[]) {
     test::createTabBar(db);
 
     testPreparedStatementResult(db);
+    testPreparedStatementCursor(db);
+    testPreparedStatementBulk(db);
   } catch (const std::exception& e) {
     std::cerr << "Exception: " << e.what() << std::endl;
     return 1;
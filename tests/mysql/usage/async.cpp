@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/mysql/all.h>
+
+#ifdef SQLPP_USE_MARIADB
+#include <poll.h>
+
+namespace {
+namespace sql = sqlpp::mysql;
+
+// A minimal event loop: Drives all queries to completion using poll.
+void run_to_completion(std::vector<sql::async_query_t*> queries) {
+  for (;;) {
+    std::vector<pollfd> fds;
+    std::vector<sql::async_query_t*> pending;
+    int timeout = -1;
+    for (auto* query : queries) {
+      if (query->done()) {
+        continue;
+      }
+      int events = 0;
+      if (query->wait_status() & MYSQL_WAIT_READ) {
+        events |= POLLIN;
+      }
+      if (query->wait_status() & MYSQL_WAIT_WRITE) {
+        events |= POLLOUT;
+      }
+      if (query->wait_status() & MYSQL_WAIT_EXCEPT) {
+        events |= POLLPRI;
+      }
+      if (query->wait_status() & MYSQL_WAIT_TIMEOUT) {
+        const auto query_timeout = static_cast<int>(query->timeout_ms());
+        timeout =
+            timeout < 0 ? query_timeout : std::min(timeout, query_timeout);
+      }
+      fds.push_back(pollfd{.fd = query->socket(),
+                           .events = static_cast<short>(events),
+                           .revents = 0});
+      pending.push_back(query);
+    }
+    if (pending.empty()) {
+      return;
+    }
+
+    const int rc = poll(fds.data(), fds.size(), timeout);
+    assert(rc >= 0);
+    for (size_t i = 0; i < pending.size(); ++i) {
+      int ready = 0;
+      if (fds[i].revents & POLLIN) {
+        ready |= MYSQL_WAIT_READ;
+      }
+      if (fds[i].revents & POLLOUT) {
+        ready |= MYSQL_WAIT_WRITE;
+      }
+      if (fds[i].revents & POLLPRI) {
+        ready |= MYSQL_WAIT_EXCEPT;
+      }
+      if (rc == 0 and (pending[i]->wait_status() & MYSQL_WAIT_TIMEOUT)) {
+        ready |= MYSQL_WAIT_TIMEOUT;
+      }
+      if (ready != 0) {
+        pending[i]->resume(ready);
+      }
+    }
+  }
+}
+}  // namespace
+
+int main(int, char*[]) {
+  try {
+    const auto tab = test::TabFoo{};
+    auto db1 = sql::make_test_connection();
+    auto db2 = sql::make_test_connection();
+
+    test::createTabFoo(db1);
+
+    // Two connections, driven by a single thread
+    auto insert = db1.start_async(insert_into(tab).set(tab.intN = 17));
+    auto slow_query = db2.start_async("SELECT SLEEP(0.1)");
+    run_to_completion({&insert, &slow_query});
+    assert(insert.affected_rows() == 1);
+    assert(slow_query.has_result());
+
+    const auto statement = select(tab.intN).from(tab).where(true);
+    auto query = db2.start_async(statement);
+    run_to_completion({&query});
+    auto count = 0;
+    for (const auto& row : db2.async_result(query, statement)) {
+      assert(row.intN == 17);
+      ++count;
+    }
+    assert(count == 1);
+
+    // The connection can be used synchronously again
+    db1(insert_into(tab).default_values());
+
+    // Errors are reported when the query is done
+    try {
+      auto bad = db1.start_async("SELECT * FROM does_not_exist");
+      run_to_completion({&bad});
+      assert(false);
+    } catch (const sql::exception&) {
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
+#else
+int main(int, char*[]) {
+  // The non-blocking API is specific to MariaDB Connector/C
+  return 0;
+}
+#endif
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <algorithm>
+
+#include <sqlpp23/tests/postgresql/all.h>
+
+namespace sql = sqlpp::postgresql;
+
+int AutoParameterize(int, char*[]) {
+  try {
+    auto config = sql::make_test_config();
+    config->auto_parameterize = true;
+    sql::connection db;
+    db.connect_using(config);
+    db("SET TIME ZONE UTC");
+
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    // Literals are replaced by typed parameters.
+    {
+      sql::context_t context{&db};
+      auto literals = std::vector<std::string>{};
+      context._literals = &literals;
+      require_equal(__LINE__,
+                    to_sql_string(context, tab.intN == 7 and
+                                               tab.textNnD == "it's"),
+                    std::string{"(tab_foo.int_n = $1::bigint) AND "
+                                "(tab_foo.text_nn_d = $2)"});
+      require_equal(__LINE__, literals.size(), size_t{2});
+      require_equal(__LINE__, literals[0], std::string{"7"});
+      require_equal(__LINE__, literals[1], std::string{"it's"});
+    }
+
+    // Values arrive in the database unchanged.
+    const auto blob = std::vector<uint8_t>{0, 1, 2, 0, 255};
+    for (int i = 0; i < 3; ++i) {
+      db(insert_into(tab).set(tab.textNnD = "it's " + std::to_string(i),
+                              tab.intN = i, tab.doubleN = 0.5 * i,
+                              tab.boolN = (i % 2 == 0), tab.blobN = blob));
+    }
+    for (int i = 0; i < 3; ++i) {
+      auto result = db(select(tab.textNnD, tab.doubleN, tab.boolN, tab.blobN)
+                           .from(tab)
+                           .where(tab.intN == i));
+      const auto& row = result.front();
+      require_equal(__LINE__, row.textNnD, "it's " + std::to_string(i));
+      require_equal(__LINE__, row.doubleN.value(), 0.5 * i);
+      require_equal(__LINE__, row.boolN.value(), (i % 2 == 0));
+      if (not std::ranges::equal(row.blobN.value(), blob)) {
+        throw std::runtime_error("Unexpected blob");
+      }
+    }
+    require_equal(__LINE__,
+                  db(update(tab).set(tab.doubleN = 1.5).where(tab.intN > 0))
+                      .affected_rows,
+                  uint64_t{2});
+    require_equal(__LINE__,
+                  db(delete_from(tab).where(tab.intN == 2)).affected_rows,
+                  uint64_t{1});
+
+    // Dates and timestamps keep their types.
+    const auto tab_dt = test::TabDateTime{};
+    test::createTabDateTime(db);
+    const auto now = std::chrono::floor<std::chrono::microseconds>(
+        std::chrono::system_clock::now());
+    const auto today = std::chrono::floor<std::chrono::days>(now);
+    db(insert_into(tab_dt).set(tab_dt.dateN = today, tab_dt.timestampN = now,
+                               tab_dt.timestampNTz = now));
+    auto result =
+        db(select(tab_dt.dateN, tab_dt.timestampN, tab_dt.timestampNTz)
+               .from(tab_dt)
+               .where(tab_dt.timestampNTz == now));
+    const auto& row = result.front();
+    require_equal(__LINE__, row.dateN.value(), today);
+    require_equal(__LINE__, row.timestampN.value(), now);
+    require_equal(__LINE__, row.timestampNTz.value(), now);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int AutoParameterize(int, char*[]) {
+  try {
+    auto config = sql::make_test_config();
+    config->statement_cache_size = 4;
+    config->auto_parameterize = true;
+    sql::connection db;
+    db.connect_using(config);
+
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    const auto initial = db.get_statement_cache_stats();
+
+    // Statements differing only in literal values share one compiled statement.
+    for (int i = 0; i < 3; ++i) {
+      db(insert_into(tab).set(tab.textNnD = "it's " + std::to_string(i),
+                              tab.intN = i, tab.doubleN = 0.5 * i,
+                              tab.boolN = (i % 2 == 0)));
+    }
+    auto stats = db.get_statement_cache_stats();
+    assert(stats.misses == initial.misses + 1);
+    assert(stats.hits == initial.hits + 2);
+
+    // Values arrive in the database unchanged.
+    for (int i = 0; i < 3; ++i) {
+      auto result = db(select(tab.textNnD, tab.doubleN, tab.boolN)
+                           .from(tab)
+                           .where(tab.intN == i));
+      const auto& row = result.front();
+      assert(row.textNnD == "it's " + std::to_string(i));
+      assert(row.doubleN == 0.5 * i);
+      assert(row.boolN == (i % 2 == 0));
+    }
+    assert(db.get_statement_cache_stats().hits == stats.hits + 2);
+
+    // Blobs are bound as well.
+    const auto blob = std::vector<uint8_t>{0, 1, 2, 0, 255};
+    const auto id = db(insert_into(tab).set(tab.textNnD = "blob",
+                                            tab.blobN = blob))
+                        .last_insert_id;
+    assert(db(select(tab.blobN).from(tab).where(tab.id == id)).front().blobN ==
+           blob);
+
+    // Dates and timestamps keep their SQLite3 representation.
+    const auto tab_dt = test::TabDateTime{};
+    test::createTabDateTime(db);
+    const auto now = std::chrono::floor<std::chrono::milliseconds>(
+        std::chrono::system_clock::now());
+    const auto today = std::chrono::floor<std::chrono::days>(now);
+    db(insert_into(tab_dt).set(tab_dt.dateN = today, tab_dt.timestampN = now));
+    auto result = db(select(tab_dt.dateN, tab_dt.timestampN)
+                         .from(tab_dt)
+                         .where(tab_dt.timestampN == now));
+    const auto& row = result.front();
+    assert(row.dateN == today);
+    assert(row.timestampN == now);
+
+    // Literals beyond SQLITE_LIMIT_VARIABLE_NUMBER are serialized inline.
+    sqlite3_limit(db.native_handle(), SQLITE_LIMIT_VARIABLE_NUMBER, 2);
+    auto rows = 0;
+    for (const auto& row : db(select(tab.id).from(tab).where(
+             tab.intN.in(std::vector<int>{0, 1, 2, 3, 4})))) {
+      std::ignore = row;
+      ++rows;
+    }
+    assert(rows == 3);
+    {
+      sql::context_t context{&db};
+      auto literals = std::vector<sql::detail::literal_parameter>{};
+      context._literals = &literals;
+      context._max_literals = 2;
+      assert(to_sql_string(context, tab.intN.in(std::vector<int>{5, 6, 7})) ==
+             "tab_foo.int_n IN (?1, ?2, 7)");
+      assert(literals.size() == 2);
+    }
+
+    // Without the option, literals are part of the statement.
+    auto plain_config = sql::make_test_config();
+    plain_config->statement_cache_size = 4;
+    sql::connection plain;
+    plain.connect_using(plain_config);
+    test::createTabFoo(plain);
+    const auto plain_initial = plain.get_statement_cache_stats();
+    plain(insert_into(tab).set(tab.textNnD = "a", tab.intN = 1));
+    plain(insert_into(tab).set(tab.textNnD = "a", tab.intN = 2));
+    assert(plain.get_statement_cache_stats().misses == plain_initial.misses + 2);
+    assert(plain.get_statement_cache_stats().hits == plain_initial.hits);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
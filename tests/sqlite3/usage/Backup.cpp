@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <filesystem>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+int64_t count_rows(sql::connection_base& db) {
+  const auto tab = test::TabFoo{};
+  auto result =
+      db(select(count(tab.id).as(sqlpp::alias::a)).from(tab).where(true));
+  return result.front().a;
+}
+
+void insert_rows(sql::connection_base& db, int64_t count) {
+  const auto tab = test::TabFoo{};
+  for (int64_t i = 0; i < count; ++i) {
+    db(insert_into(tab).set(tab.textNnD = std::string(200, 'x')));
+  }
+}
+}  // namespace
+
+int Backup(int, char*[]) {
+  const auto directory = std::filesystem::temp_directory_path();
+  const auto source_path = (directory / "sqlpp23_backup_source.db").string();
+  const auto target_path = (directory / "sqlpp23_backup_target.db").string();
+  std::filesystem::remove(source_path);
+  std::filesystem::remove(target_path);
+
+  try {
+    auto file_config = sql::make_test_config();
+    file_config->path_to_database = source_path;
+    {
+      sql::connection file_db{file_config};
+      test::createTabFoo(file_db);
+      insert_rows(file_db, 1000);
+    }
+
+    // Load a file database into memory, in steps.
+    auto db = sql::make_test_connection();
+    auto progress = std::vector<sql::backup_progress>{};
+    db.load_from_file(source_path, 10, [&](const sql::backup_progress& p) {
+      progress.push_back(p);
+    });
+    assert(progress.size() > 2);
+    assert(progress.back().remaining == 0);
+    assert(progress.front().page_count == progress.back().page_count);
+    assert(count_rows(db) == 1000);
+
+    // Write the in-memory database back to disk, one step at a time.
+    insert_rows(db, 10);
+    {
+      auto backup = db.start_save_to_file(target_path);
+      int steps = 0;
+      while (not backup.step(5)) {
+        ++steps;
+        assert(backup.progress().remaining > 0);
+      }
+      assert(steps > 1);
+      assert(backup.done());
+      assert(backup.progress().remaining == 0);
+    }
+    {
+      auto target_config = sql::make_test_config();
+      target_config->path_to_database = target_path;
+      sql::connection target_db{target_config};
+      assert(count_rows(target_db) == 1010);
+    }
+
+    // Missing files
+    try {
+      db.load_from_file((directory / "sqlpp23_missing" / "x.db").string());
+      assert(false);
+    } catch (const sql::exception&) {
+    }
+
+    // Swap snapshots into a connection pool.
+    auto pool = sql::connection_pool{file_config, 5};
+    sql::load_snapshot(pool, *file_config, source_path);
+    {
+      auto old_snapshot = pool.get();
+      assert(count_rows(old_snapshot) == 1000);
+      {
+        // Connections of the pool share the snapshot.
+        auto other = pool.get();
+        insert_rows(other, 1);
+        assert(count_rows(old_snapshot) == 1001);
+      }
+      assert(pool.available() == 1);
+
+      sql::load_snapshot(pool, *file_config, target_path);
+      assert(pool.available() == 0);
+      auto new_snapshot = pool.get();
+      assert(count_rows(new_snapshot) == 1010);
+      // Connections to the previous snapshot are still valid.
+      assert(count_rows(old_snapshot) == 1001);
+    }
+    // ... but they are not returned to the pool.
+    assert(pool.available() == 1);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    std::filesystem::remove(source_path);
+    std::filesystem::remove(target_path);
+    return 1;
+  }
+  std::filesystem::remove(source_path);
+  std::filesystem::remove(target_path);
+  return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <array>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int BlobIO(int, char*[]) {
+  try {
+    auto db = sql::make_test_connection();
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    constexpr size_t blob_size = 10000;
+    constexpr size_t chunk_size = 256;
+    for (int64_t id = 1; id <= 3; ++id) {
+      db(insert_into(tab).set(tab.id = id,
+                              tab.blobN = sql::zeroblob(
+                                  static_cast<int64_t>(blob_size))));
+    }
+
+    // Write in chunks.
+    auto chunk = std::array<uint8_t, chunk_size>{};
+    {
+      auto blob = db.open_blob(tab.blobN, 1, sql::blob_mode::read_write);
+      assert(blob.size() == blob_size);
+      for (int64_t id = 1; id <= 3; ++id) {
+        if (id > 1) {
+          blob.reopen(id);
+        }
+        for (size_t offset = 0; offset < blob_size; offset += chunk_size) {
+          const auto length = std::min(chunk_size, blob_size - offset);
+          for (size_t i = 0; i < length; ++i) {
+            chunk[i] = static_cast<uint8_t>(
+                (offset + i + static_cast<size_t>(id)) % 251);
+          }
+          blob.write(std::span{chunk}.first(length), offset);
+        }
+      }
+
+      // Writing cannot extend the blob.
+      try {
+        blob.write(chunk, blob_size - 1);
+        assert(false);
+      } catch (const sql::exception&) {
+      }
+    }
+
+    // Read in chunks.
+    {
+      auto blob = db.open_blob(tab.blobN, 1);
+      for (int64_t id = 1; id <= 3; ++id) {
+        if (id > 1) {
+          blob.reopen(id);
+        }
+        assert(blob.size() == blob_size);
+        for (size_t offset = 0; offset < blob_size; offset += chunk_size) {
+          const auto length = std::min(chunk_size, blob_size - offset);
+          blob.read(std::span{chunk}.first(length), offset);
+          for (size_t i = 0; i < length; ++i) {
+            assert(chunk[i] == static_cast<uint8_t>(
+                                   (offset + i + static_cast<size_t>(id)) % 251));
+          }
+        }
+      }
+
+      // Read-only handles cannot write.
+      try {
+        blob.write(std::span{chunk}.first(1));
+        assert(false);
+      } catch (const sql::exception&) {
+      }
+
+      // Missing rows
+      try {
+        blob.reopen(17);
+        assert(false);
+      } catch (const sql::exception&) {
+      }
+    }
+
+    // The written data is visible to statements.
+    for (const auto& row :
+         db(select(tab.id, tab.blobN).from(tab).where(tab.id == 2))) {
+      assert(row.blobN.has_value());
+      assert(row.blobN->size() == blob_size);
+      assert((*row.blobN)[0] == 2);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
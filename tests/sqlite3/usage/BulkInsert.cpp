@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <ranges>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int BulkInsert(int, char*[]) {
+  try {
+    auto db = sql::make_test_connection();
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    // Allow 3 rows per statement to test full chunks as well as the tail.
+    sqlite3_limit(db.native_handle(), SQLITE_LIMIT_VARIABLE_NUMBER, 10);
+
+    auto rows =
+        std::vector<std::tuple<std::string, std::optional<int64_t>,
+                               std::optional<std::vector<uint8_t>>>>{};
+    for (int64_t i = 0; i < 11; ++i) {
+      rows.emplace_back(std::to_string(i),
+                        i % 2 ? std::optional<int64_t>{i} : std::nullopt,
+                        std::vector<uint8_t>{static_cast<uint8_t>(i)});
+    }
+    auto result = db.bulk_insert(
+        tab, std::make_tuple(tab.textNnD, tab.intN, tab.blobN), rows);
+    assert(result.affected_rows == 11);
+    assert(not db.is_transaction_active());
+
+    int64_t count = 0;
+    for (const auto& row :
+         db(select(tab.textNnD, tab.intN, tab.blobN).from(tab).where(true))) {
+      const int64_t i = std::stoll(std::string{row.textNnD});
+      assert(row.intN == (i % 2 ? std::optional<int64_t>{i} : std::nullopt));
+      assert(row.blobN.has_value());
+      assert(row.blobN->size() == 1);
+      assert(row.blobN->front() == static_cast<uint8_t>(i));
+      ++count;
+    }
+    assert(count == 11);
+
+    // Rows that do not outlive the statement, with values that need to be
+    // converted.
+    db(delete_from(tab).where(true));
+    auto generated = std::views::iota(0, 5) | std::views::transform([](int i) {
+                       return std::make_tuple(std::to_string(i * 10), i);
+                     });
+    result =
+        db.bulk_insert(tab, std::make_tuple(tab.textNnD, tab.intN), generated);
+    assert(result.affected_rows == 5);
+    for (const auto& row :
+         db(select(tab.textNnD, tab.intN).from(tab).where(true))) {
+      assert(row.textNnD == std::to_string(*row.intN * 10));
+    }
+
+    // Nothing to insert
+    result = db.bulk_insert(tab, std::make_tuple(tab.intN),
+                            std::vector<std::tuple<int64_t>>{});
+    assert(result.affected_rows == 0);
+
+    // A failing insert leaves the table unchanged.
+    db(delete_from(tab).where(true));
+    try {
+      db.bulk_insert(tab, std::make_tuple(tab.id, tab.intN),
+                     std::vector<std::tuple<int64_t, int64_t>>{
+                         {1, 1}, {2, 2}, {3, 3}, {4, 4}, {1, 5}});
+      assert(false);
+    } catch (const sql::exception&) {
+    }
+    assert(not db.is_transaction_active());
+    assert(db(select(tab.id).from(tab).where(true)).empty());
+
+    // Inside an active transaction, bulk_insert does not commit.
+    auto tx = start_transaction(db);
+    db.bulk_insert(tab, std::make_tuple(tab.intN),
+                   std::vector<std::tuple<int64_t>>{{1}, {2}});
+    tx.rollback();
+    assert(db(select(tab.id).from(tab).where(true)).empty());
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+SQLPP_CREATE_NAME_TAG(ids);
+SQLPP_CREATE_NAME_TAG(texts);
+}  // namespace
+
+int Carray(int, char*[]) {
+  try {
+    auto db = sql::make_test_connection();
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    for (int64_t i = 1; i <= 5; ++i) {
+      db(insert_into(tab).set(tab.id = i, tab.textNnD = std::to_string(i)));
+    }
+
+    // Integers
+    auto select_by_id = db.prepare(
+        select(tab.id)
+            .from(tab)
+            .where(tab.id.in(sql::carray_parameter<int64_t>(ids)))
+            .order_by(tab.id.asc()));
+    const auto selected_ids = [&] {
+      auto result = std::vector<int64_t>{};
+      for (const auto& row : db(select_by_id)) {
+        result.push_back(row.id);
+      }
+      return result;
+    };
+
+    const auto some_ids = std::vector<int64_t>{4, 2, 17};
+    select_by_id.parameters.ids = some_ids;
+    assert((selected_ids() == std::vector<int64_t>{2, 4}));
+
+    // The same prepared statement serves arrays of any size.
+    auto many_ids = std::vector<int64_t>{};
+    for (int64_t i = 0; i < 10000; ++i) {
+      many_ids.push_back(i * 2 + 1);
+    }
+    select_by_id.parameters.ids = many_ids;
+    assert((selected_ids() == std::vector<int64_t>{1, 3, 5}));
+
+    select_by_id.parameters.ids = {};
+    assert(selected_ids().empty());
+
+    // Texts
+    auto select_by_text = db.prepare(
+        select(tab.id)
+            .from(tab)
+            .where(tab.textNnD.not_in(sql::carray_parameter<std::string>(texts)))
+            .order_by(tab.id.asc()));
+    const auto some_texts = std::vector<std::string>{"1", "3", "5"};
+    select_by_text.parameters.texts = some_texts;
+    auto result = std::vector<int64_t>{};
+    for (const auto& row : db(select_by_text)) {
+      result.push_back(row.id);
+    }
+    assert((result == std::vector<int64_t>{2, 4}));
+
+    // Default constructed string_views are empty texts, not NULL.
+    db(insert_into(tab).set(tab.id = 6, tab.textNnD = ""));
+    auto select_by_view = db.prepare(
+        select(tab.id).from(tab).where(
+            tab.textNnD.in(sql::carray_parameter<std::string_view>(texts))));
+    const auto empty_views = std::vector<std::string_view>{std::string_view{}};
+    select_by_view.parameters.texts = empty_views;
+    result.clear();
+    for (const auto& row : db(select_by_view)) {
+      result.push_back(row.id);
+    }
+    assert((result == std::vector<int64_t>{6}));
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <set>
+#include <vector>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int ChangeHooks(int, char*[]) {
+  try {
+    auto db = sql::make_test_connection();
+    const auto foo = test::TabFoo{};
+    const auto bar = test::TabBar{};
+    test::createTabFoo(db);
+    test::createTabBar(db);
+
+    auto changes = std::vector<sql::row_change>{};
+    auto tables = std::vector<std::string>{};
+    auto invalid_foo_ids = std::set<int64_t>{};
+    auto commits = 0;
+    auto rollbacks = 0;
+    db.set_update_hook([&](const sql::row_change& change) {
+      changes.push_back(change);
+      tables.emplace_back(change.table);  // only valid during the call
+    });
+    db.add_table_hook(foo, [&](sql::change_operation, int64_t rowid) {
+      invalid_foo_ids.insert(rowid);
+    });
+    db.set_commit_hook([&]() { ++commits; });
+    db.set_rollback_hook([&]() { ++rollbacks; });
+
+    const auto id = db(insert_into(foo).set(foo.intN = 17)).last_insert_id;
+    db(insert_into(bar).set(bar.boolNn = true));
+    assert(changes.size() == 2);
+    assert(changes[0].operation == sql::change_operation::insert);
+    assert(changes[0].rowid == static_cast<int64_t>(id));
+    assert(tables[0] == "tab_foo");
+    assert(tables[1] == "tab_bar");
+    assert(invalid_foo_ids == std::set<int64_t>{static_cast<int64_t>(id)});
+    assert(commits == 2);  // Each statement is committed implicitly.
+
+    // Matching changes to tables.
+    changes.clear();
+    tables.clear();
+    invalid_foo_ids.clear();
+    db.set_update_hook([&](const sql::row_change& change) {
+      assert(change.database == "main");
+      assert(change.is(foo) != change.is(bar));
+      changes.push_back(change);
+    });
+    db(update(foo).set(foo.intN = 18).where(foo.id == id));
+    db(delete_from(bar).where(true));
+    assert(changes.size() == 2);
+    assert(changes[0].operation == sql::change_operation::update);
+    assert(changes[1].operation == sql::change_operation::delete_from);
+    assert(invalid_foo_ids == std::set<int64_t>{static_cast<int64_t>(id)});
+
+    // Rolled back transactions
+    changes.clear();
+    commits = 0;
+    {
+      auto tx = start_transaction(db);
+      db(insert_into(foo).default_values());
+      tx.rollback();
+    }
+    assert(changes.size() == 1);
+    assert(commits == 0);
+    assert(rollbacks == 1);
+
+    // Removing hooks
+    changes.clear();
+    db.clear_hooks();
+    db(insert_into(foo).default_values());
+    assert(changes.empty());
+    assert(commits == 0);
+
+    // Hooks are removed when pooled connections are returned to the pool.
+    auto pool_config = sql::make_test_config();
+    pool_config->path_to_database =
+        "file:testchangehooks?mode=memory&cache=shared";
+    pool_config->flags =
+        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI;
+    sql::connection_pool pool{pool_config, 1};
+    {
+      auto pooled = pool.get();
+      test::createTabFoo(pooled);
+      pooled.set_commit_hook([&]() { ++commits; });
+      pooled(insert_into(foo).default_values());
+      assert(commits == 1);
+    }
+    {
+      auto pooled = pool.get();
+      pooled(insert_into(foo).default_values());
+      assert(commits == 1);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
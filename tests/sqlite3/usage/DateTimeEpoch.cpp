@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace {
+SQLPP_CREATE_NAME_TAG(storage);
+
+const auto now = std::chrono::floor<::std::chrono::microseconds>(
+    std::chrono::system_clock::now());
+const auto today = std::chrono::floor<std::chrono::days>(now);
+const auto time_of_day = std::chrono::microseconds{now - today};
+const auto yesterday = today - std::chrono::days{1};
+}  // namespace
+
+namespace sql = sqlpp::sqlite3;
+int DateTimeEpoch(int, char*[]) {
+  try {
+    auto config = sql::make_test_config();
+    config->date_time_storage = sql::chrono_storage::integer_epoch;
+    sql::connection db;
+    db.connect_using(config);
+    test::createTabDateTime(db);
+
+    const auto tab = test::TabDateTime{};
+
+    // Literals
+    db(insert_into(tab).set(tab.dateN = yesterday, tab.timestampN = now,
+                            tab.timeN = time_of_day));
+    const auto types =
+        db(select(sqlpp::verbatim<sqlpp::text>(
+                      "typeof(date_n) || typeof(timestamp_n) || typeof(time_n)")
+                      .as(storage))
+               .from(tab)
+               .where(true));
+    require_equal(__LINE__, types.front().storage.value(),
+                  "integerintegerinteger");
+
+    for (const auto& row :
+         db(select(all_of(tab)).from(tab).where(tab.timestampN <= now))) {
+      require_equal(__LINE__, row.dateN.value(), yesterday);
+      require_equal(__LINE__, row.timestampN.value(), now);
+      require_equal(__LINE__, row.timeN.value(), time_of_day);
+    }
+
+    // Parameters
+    auto prepared_update =
+        db.prepare(update(tab).set(tab.dateN = parameter(tab.dateN),
+                                   tab.timestampN = parameter(tab.timestampN),
+                                   tab.timeN = parameter(tab.timeN)));
+    prepared_update.parameters.dateN = today;
+    prepared_update.parameters.timestampN = now + std::chrono::seconds{1};
+    prepared_update.parameters.timeN = time_of_day;
+    db(prepared_update);
+
+    auto prepared_select = db.prepare(
+        select(all_of(tab))
+            .from(tab)
+            .where(tab.timestampN > parameter(tab.timestampN)));
+    prepared_select.parameters.timestampN = now;
+    auto count = 0;
+    for (const auto& row : db(prepared_select)) {
+      require_equal(__LINE__, row.dateN.value(), today);
+      require_equal(__LINE__, row.timestampN.value(),
+                    now + std::chrono::seconds{1});
+      require_equal(__LINE__, row.timeN.value(), time_of_day);
+      ++count;
+    }
+    require_equal(__LINE__, count, 1);
+
+    // Text values, e.g. from defaults, are still read.
+    for (const auto& row : db(select(all_of(tab)).from(tab).where(true))) {
+      require_equal(__LINE__, row.dateTimestampND.has_value(), true);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
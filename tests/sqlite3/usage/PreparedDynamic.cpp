@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+// Optional search criteria, e.g. from a web form.
+struct search_filter {
+  std::optional<int64_t> min_int;
+  std::optional<std::string> text;
+  std::optional<bool> flag;
+};
+}  // namespace
+
+int PreparedDynamic(int, char*[]) {
+  try {
+    auto db = sql::make_test_connection();
+    test::createTabFoo(db);
+
+    const auto tab = test::TabFoo{};
+    for (int i = 0; i < 10; ++i) {
+      db(insert_into(tab).set(tab.textNnD = "row" + std::to_string(i % 3),
+                              tab.intN = i, tab.boolN = (i % 2 == 0)));
+    }
+
+    // Parameters in inactive dynamic parts are not bound.
+    auto prepared = db.prepare(
+        select(tab.id)
+            .from(tab)
+            .where(tab.id > 0 and
+                   dynamic(false, tab.intN >= parameter(tab.intN)) and
+                   tab.textNnD == parameter(tab.textNnD)));
+    prepared.parameters.intN = 100;
+    prepared.parameters.textNnD = "row1";
+    auto rows = 0;
+    for (const auto& row : db(prepared)) {
+      std::ignore = row;
+      ++rows;
+    }
+    assert(rows == 3);
+
+    // One prepared statement per combination of active filters.
+    const auto search = [&](const search_filter& filter) {
+      auto cached = db.cached(
+          select(tab.id)
+              .from(tab)
+              .where(tab.id > 0 and
+                     dynamic(filter.min_int.has_value(),
+                             tab.intN >= parameter(tab.intN)) and
+                     dynamic(filter.text.has_value(),
+                             tab.textNnD == parameter(tab.textNnD)) and
+                     dynamic(filter.flag.has_value(),
+                             tab.boolN == parameter(tab.boolN))));
+      cached->parameters.intN = filter.min_int;
+      cached->parameters.textNnD = filter.text.value_or("");
+      cached->parameters.boolN = filter.flag;
+      auto count = 0;
+      for (const auto& row : db(*cached)) {
+        std::ignore = row;
+        ++count;
+      }
+      return count;
+    };
+
+    const auto initial = db.get_prepared_statement_cache_stats();
+    assert(search({}) == 10);
+    assert(search({.min_int = 5}) == 5);
+    assert(search({.min_int = 8}) == 2);
+    assert(search({.text = "row1"}) == 3);
+    assert(search({.min_int = 5, .text = "row1"}) == 1);
+    assert(search({.text = "row1", .flag = true}) == 1);
+    assert(search({.min_int = 3, .text = "row1", .flag = true}) == 1);
+    assert(search({.min_int = 5, .text = "row1", .flag = true}) == 0);
+    assert(search({.min_int = 0, .text = "row2"}) == 3);
+
+    const auto& stats = db.get_prepared_statement_cache_stats();
+    assert(stats.misses == initial.misses + 6);
+    assert(stats.hits == initial.hits + 3);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int PreparedStatementCache(int, char*[]) {
+  try {
+    auto config = sql::make_test_config();
+    config->prepared_statement_cache_size = 2;
+    sql::connection db;
+    db.connect_using(config);
+
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    // The statement is prepared once and then taken from the cache.
+    for (int i = 0; i < 3; ++i) {
+      db.run_cached(insert_into(tab).set(tab.intN = 7));
+    }
+    auto stats = db.get_prepared_statement_cache_stats();
+    assert(stats.misses == 1);
+    assert(stats.hits == 2);
+
+    // Parameters are set via the cached prepared statement.
+    const auto select_by_id =
+        select(tab.intN).from(tab).where(tab.id == parameter(tab.id));
+    for (int64_t id = 1; id <= 3; ++id) {
+      auto prepared = db.cached(select_by_id);
+      prepared->parameters.id = id;
+      auto rows = 0;
+      for (const auto& row : db(*prepared)) {
+        assert(row.intN == 7);
+        ++rows;
+      }
+      assert(rows == 1);
+    }
+    assert(db.cached(select_by_id) == db.cached(select_by_id));
+
+    // Hits are counted per statement, most recently used first.
+    auto entries = db.get_prepared_statement_cache_entries();
+    assert(entries.size() == 2);
+    assert(entries.front().sql.starts_with("SELECT"));
+    assert(entries.front().hits == 4);
+    assert(entries.back().sql.starts_with("INSERT"));
+    assert(entries.back().hits == 2);
+
+    // Literal values are bound, so statements that differ only in their
+    // values share one prepared statement.
+    for (int64_t id = 1; id <= 3; ++id) {
+      auto rows = 0;
+      for (const auto& row : db.run_cached(
+               select(tab.id).from(tab).where(tab.intN == 7 and tab.id == id))) {
+        assert(row.id == id);
+        ++rows;
+      }
+      assert(rows == 1);
+    }
+    stats = db.get_prepared_statement_cache_stats();
+    assert(stats.misses == 3);
+    assert(stats.hits == 8);
+
+    // Literals and parameters are bound at their positions.
+    const auto select_mixed = [&](int64_t int_n) {
+      return select(tab.id).from(tab).where(tab.intN == int_n and
+                                            tab.id == parameter(tab.id));
+    };
+    auto mixed = db.cached(select_mixed(8));
+    mixed->parameters.id = 2;
+    assert(db(*mixed).empty());
+    assert(db.cached(select_mixed(7)) == mixed);
+    assert(db(*mixed).front().id == 2);
+
+    // The least recently used statements are evicted. Statements in use are
+    // kept alive by their pointers, though.
+    auto pinned = db.cached(select_by_id);
+    db.run_cached(insert_into(tab).set(tab.intN = 7));
+    db.run_cached(select(tab.id).from(tab));
+    stats = db.get_prepared_statement_cache_stats();
+    assert(stats.evictions == 5);
+    assert(db.get_prepared_statement_cache_entries().size() == 2);
+    pinned->parameters.id = 1;
+    assert(db(*pinned).front().intN == 7);
+
+    db.clear_prepared_statement_cache();
+    assert(db.get_prepared_statement_cache_entries().empty());
+
+    // Nothing is cached with a capacity of zero.
+    auto uncached_config = sql::make_test_config();
+    uncached_config->prepared_statement_cache_size = 0;
+    sql::connection uncached;
+    uncached.connect_using(uncached_config);
+    test::createTabFoo(uncached);
+    assert(uncached.cached(select_by_id) != uncached.cached(select_by_id));
+    assert(uncached.get_prepared_statement_cache_entries().empty());
+
+    // Pooled connections keep their cache while in the pool.
+    auto pool_config = sql::make_test_config();
+    pool_config->path_to_database =
+        "file:testpreparedcache?mode=memory&cache=shared";
+    pool_config->flags =
+        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI;
+    sql::connection_pool pool{pool_config, 1};
+    {
+      auto pooled = pool.get();
+      test::createTabFoo(pooled);
+      pooled.run_cached(insert_into(tab).set(tab.intN = 7));
+    }
+    {
+      auto pooled = pool.get();
+      pooled.run_cached(insert_into(tab).set(tab.intN = 7));
+      assert(pooled.get_prepared_statement_cache_stats().hits == 1);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
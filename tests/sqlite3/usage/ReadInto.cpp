@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+struct Foo {
+  int64_t id;
+  std::string text;
+  std::optional<int64_t> value;
+  std::optional<std::vector<uint8_t>> data;
+};
+}  // namespace
+
+int ReadInto(int, char*[]) {
+  try {
+    sql::connection db = sql::make_test_connection();
+
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    for (int i = 0; i < 3; ++i) {
+      db(insert_into(tab).set(
+          tab.textNnD = "row " + std::to_string(i),
+          tab.intN = i % 2 == 0 ? std::make_optional<int64_t>(i) : std::nullopt,
+          tab.blobN = std::vector<uint8_t>(static_cast<size_t>(i) + 1, 42)));
+    }
+
+    // Rows are mapped to members by order, text and blobs are copied.
+    const auto rows =
+        db(select(tab.id, tab.textNnD, tab.intN, tab.blobN).from(tab).order_by(
+               tab.id.asc()))
+            .into<Foo>();
+    assert(rows.size() == 3);
+    for (size_t i = 0; i < rows.size(); ++i) {
+      assert(rows[i].text == "row " + std::to_string(i));
+      assert(rows[i].value ==
+             (i % 2 == 0 ? std::make_optional<int64_t>(static_cast<int64_t>(i))
+                         : std::nullopt));
+      assert(rows[i].data == std::vector<uint8_t>(i + 1, 42));
+    }
+
+    // read_into appends the remaining rows.
+    auto result =
+        db(select(tab.id, tab.textNnD, tab.intN, tab.blobN).from(tab).order_by(
+            tab.id.asc()));
+    result.pop_front();
+    std::vector<Foo> appended = {Foo{0, "first", std::nullopt, std::nullopt}};
+    sqlpp::read_into(result, appended);
+    assert(appended.size() == 3);
+    assert(appended.front().text == "first");
+    assert(appended.back().text == "row 2");
+    assert(result.empty());
+
+    // Other targets only need to be constructible from the fields.
+    const auto texts =
+        db(select(tab.textNnD).from(tab).where(tab.intN.is_null()))
+            .into<std::string>();
+    assert(texts == std::vector<std::string>{"row 1"});
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
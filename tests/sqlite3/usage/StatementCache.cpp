@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int StatementCache(int, char*[]) {
+  try {
+    auto config = sql::make_test_config();
+    config->statement_cache_size = 2;
+    sql::connection db;
+    db.connect_using(config);
+
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    const auto initial = db.get_statement_cache_stats();
+
+    // Repeated direct execution compiles the statement once.
+    for (int i = 0; i < 3; ++i) {
+      db(insert_into(tab).set(tab.intN = 7));
+    }
+    auto stats = db.get_statement_cache_stats();
+    assert(stats.misses == initial.misses + 1);
+    assert(stats.hits == initial.hits + 2);
+
+    // A statement cannot be reused while its result is in use.
+    const auto select_all = select(tab.intN).from(tab).where(true);
+    auto outer_rows = 0;
+    for (const auto& outer : db(select_all)) {
+      assert(outer.intN == 7);
+      ++outer_rows;
+      auto inner_rows = 0;
+      for (const auto& inner : db(select_all)) {
+        assert(inner.intN == 7);
+        ++inner_rows;
+      }
+      assert(inner_rows == 3);
+    }
+    assert(outer_rows == 3);
+
+    // Once the result is gone, the statement is reused again.
+    stats = db.get_statement_cache_stats();
+    for (const auto& row : db(select_all)) {
+      assert(row.intN == 7);
+    }
+    assert(db.get_statement_cache_stats().hits == stats.hits + 1);
+
+    // The least recently used statement is evicted.
+    db(R"(SELECT 1)");
+    db(R"(SELECT 2)");
+    stats = db.get_statement_cache_stats();
+    db(select_all);
+    assert(db.get_statement_cache_stats().misses == stats.misses + 1);
+
+    // Cached statements are not affected by schema changes.
+    db(R"(ALTER TABLE tab_foo ADD COLUMN extra int)");
+    auto rows = 0;
+    for (const auto& row : db(select_all)) {
+      assert(row.intN == 7);
+      ++rows;
+    }
+    assert(rows == 3);
+
+    // Without cache, there are no hits or misses.
+    auto uncached = sql::make_test_connection();
+    uncached(R"(SELECT 1)");
+    uncached(R"(SELECT 1)");
+    assert(uncached.get_statement_cache_stats().hits == 0);
+    assert(uncached.get_statement_cache_stats().misses == 0);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <string>
+#include <vector>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int StatementStatus(int, char*[]) {
+  try {
+    auto reported = std::vector<std::pair<std::string, sql::statement_status>>{};
+    auto config = sql::make_test_config();
+    config->statement_status_callback = [&reported](
+                                            std::string_view statement,
+                                            const sql::statement_status& s) {
+      reported.emplace_back(std::string{statement}, s);
+    };
+    sql::connection db;
+    db.connect_using(config);
+
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+    for (int64_t i = 0; i < 100; ++i) {
+      db(insert_into(tab).set(tab.intN = 100 - i));
+    }
+
+    // Statements that run to completion are reported.
+    assert(not reported.empty());
+    assert(reported.back().first.starts_with("INSERT INTO tab_foo"));
+    assert(reported.back().second.runs == 1);
+
+    // No index on int_n: full table scan.
+    auto p = db.prepare(
+        select(tab.id).from(tab).where(tab.intN == parameter(tab.intN)));
+    for (int64_t i = 1; i <= 3; ++i) {
+      p.params.intN = i;
+      for (const auto& row : db(p)) {
+        assert(row.id == 101 - i);
+      }
+    }
+    {
+      const auto status = db.get_statement_status(p);
+      assert(status.fullscan_steps > 0);
+      assert(status.sorts == 0);
+      assert(status.vm_steps > 0);
+    }
+
+    // Counters are reset by the callback after each run.
+    reported.clear();
+    p.params.intN = 4;
+    for (const auto& row : db(p)) {
+      assert(row.id == 97);
+    }
+    assert(reported.size() == 1);
+    assert(reported.front().second.fullscan_steps > 0);
+    assert(db.get_statement_status(p).fullscan_steps == 0);
+
+    // Ordering by a column without index requires a sort.
+    reported.clear();
+    for (const auto& row : db(select(tab.id).from(tab).where(true).order_by(
+             tab.intN.asc()))) {
+      std::ignore = row;
+    }
+    assert(reported.size() == 1);
+    assert(reported.front().second.sorts > 0);
+
+    // Results that are not fully consumed are not reported.
+    reported.clear();
+    {
+      auto result = db(select(tab.id).from(tab).where(true));
+      assert(not result.empty());
+    }
+    assert(reported.empty());
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+SQLPP_CREATE_NAME_TAG(score);
+SQLPP_CREATE_NAME_TAG(fail);
+SQLPP_CREATE_NAME_TAG(sum_of_squares);
+SQLPP_CREATE_NAME_TAG(joined);
+
+// Usable as window function.
+struct sum_of_squares_t {
+  int64_t total = 0;
+
+  void step(int64_t value) { total += value * value; }
+  void inverse(int64_t value) { total -= value * value; }
+  int64_t value() const { return total; }
+  int64_t finalize() const { return total; }
+};
+
+struct joined_t {
+  std::string text;
+
+  void step(std::string_view value, std::optional<int64_t> number) {
+    text += value;
+    text += number ? std::to_string(*number) : "-";
+  }
+  std::string finalize() { return text; }
+};
+}  // namespace
+
+int UserFunction(int, char*[]) {
+  try {
+    auto db = sql::make_test_connection();
+    const auto tab = test::TabFoo{};
+    test::createTabFoo(db);
+
+    db(insert_into(tab).set(tab.id = 1, tab.intN = 1, tab.textNnD = "a"));
+    db(insert_into(tab).set(tab.id = 2, tab.intN = 2, tab.textNnD = "bb"));
+    db(insert_into(tab).set(tab.id = 3, tab.intN = std::nullopt,
+                            tab.textNnD = "ccc"));
+    db(insert_into(tab).set(tab.id = 4, tab.intN = 4, tab.textNnD = "dddd"));
+
+    // Scalar function
+    const auto score_of =
+        db.create_function(score,
+                           [](int64_t number, std::string_view text) {
+                             return static_cast<double>(number) /
+                                    static_cast<double>(text.size());
+                           },
+                           SQLITE_DETERMINISTIC);
+    static_assert(
+        std::is_same_v<sqlpp::data_type_of_t<decltype(score_of(tab.intN,
+                                                                tab.textNnD))>,
+                       std::optional<sqlpp::floating_point>>);
+    auto ids = std::vector<int64_t>{};
+    for (const auto& row : db(select(tab.id, score_of(tab.intN, tab.textNnD)
+                                                 .as(sqlpp::alias::a))
+                                  .from(tab)
+                                  .where(score_of(tab.intN, tab.textNnD) >= 1.0)
+                                  .order_by(tab.id.asc()))) {
+      assert(row.a.has_value());
+      assert(*row.a >= 1.0);
+      ids.push_back(row.id);
+    }
+    assert((ids == std::vector<int64_t>{1, 2, 4}));
+
+    // NULL arguments yield NULL.
+    {
+      auto result = db(select(score_of(tab.intN, tab.textNnD).as(sqlpp::alias::a))
+                           .from(tab)
+                           .where(tab.id == 3));
+      assert(not result.front().a.has_value());
+    }
+
+    // Exceptions are reported as errors.
+    const auto failing = db.create_function(
+        fail, [](int64_t) -> int64_t { throw std::runtime_error{"failed"}; });
+    try {
+      db(select(failing(tab.id).as(sqlpp::alias::a)).from(tab).where(true));
+      assert(false);
+    } catch (const sql::exception& e) {
+      assert(std::string_view{e.what()}.find("failed") != std::string_view::npos);
+    }
+
+    // Aggregate function
+    const auto squares = db.create_aggregate<sum_of_squares_t>(sum_of_squares);
+    const auto joined_text = db.create_aggregate<joined_t>(joined);
+    {
+      auto result = db(select(squares(tab.intN).as(sqlpp::alias::a),
+                              joined_text(tab.textNnD, tab.intN).as(sqlpp::alias::b))
+                           .from(tab)
+                           .where(true));
+      assert(result.front().a == 1 + 4 + 16);
+      assert(result.front().b == "a1bb2ccc-dddd4");
+    }
+    {
+      // No rows
+      auto result = db(select(squares(tab.intN).as(sqlpp::alias::a))
+                           .from(tab)
+                           .where(false));
+      assert(result.front().a == 0);
+    }
+
+    // Window function
+    auto totals = std::vector<int64_t>{};
+    for (const auto& row :
+         db(select(tab.id, squares(tab.intN).over().as(sqlpp::alias::a))
+                .from(tab)
+                .where(true))) {
+      totals.push_back(row.a);
+    }
+    assert((totals == std::vector<int64_t>{21, 21, 21, 21}));
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
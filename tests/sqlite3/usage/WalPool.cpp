@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <filesystem>
+#include <future>
+#include <thread>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = ::sqlpp::sqlite3;
+
+namespace {
+void remove_database(const std::string& path) {
+  for (const auto* suffix : {"", "-wal", "-shm"}) {
+    std::filesystem::remove(path + suffix);
+  }
+}
+
+int64_t journal_mode_is_wal(sql::pooled_connection& db) {
+  auto is_wal = int64_t{0};
+  sqlite3_exec(
+      db.native_handle(), "PRAGMA journal_mode",
+      [](void* result, int, char** values, char**) {
+        *static_cast<int64_t*>(result) =
+            (values[0] and std::string_view{values[0]} == "wal") ? 1 : 0;
+        return 0;
+      },
+      &is_wal, nullptr);
+  return is_wal;
+}
+}  // namespace
+
+int WalPool(int, char*[]) {
+  // WAL mode requires a database file.
+  const auto path =
+      (std::filesystem::temp_directory_path() / "sqlpp23_wal_pool.db")
+          .string();
+  remove_database(path);
+
+  try {
+    auto config = std::make_shared<sql::connection_config>();
+    config->path_to_database = path;
+    config->flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+    config->pragmas = {{"synchronous", "NORMAL"},
+                       {"cache_size", "-4000"},
+                       {"mmap_size", "268435456"}};
+    config->debug = sql::get_debug_logger();
+
+    const auto tab = test::TabFoo{};
+    sql::wal_pool pool{config, 3};
+    assert(pool.available_readers() == 3);
+
+    pool.write([](sql::connection& db) { test::createTabFoo(db); }).get();
+
+    // Writes from several threads are serialized by the pool.
+    auto writers = std::vector<std::thread>{};
+    for (int64_t t = 0; t < 4; ++t) {
+      writers.emplace_back([&pool, &tab, t] {
+        auto ids = std::vector<std::future<uint64_t>>{};
+        for (int64_t i = 0; i < 25; ++i) {
+          ids.push_back(
+              pool.write([&tab, value = t * 25 + i](sql::connection& db) {
+                return db(insert_into(tab).set(tab.intN = value))
+                    .last_insert_id;
+              }));
+        }
+        for (auto& id : ids) {
+          assert(id.get() > 0);
+        }
+      });
+    }
+    for (auto& writer : writers) {
+      writer.join();
+    }
+
+    // A failing task only rolls back its own changes.
+    auto failing = pool.write([&tab](sql::connection& db) {
+      db(insert_into(tab).set(tab.intN = 1000));
+      throw std::runtime_error{"task failed"};
+    });
+    auto succeeding = pool.write([&tab](sql::connection& db) {
+      db(insert_into(tab).set(tab.intN = 1001));
+    });
+    try {
+      failing.get();
+      assert(false);
+    } catch (const std::runtime_error&) {
+    }
+    succeeding.get();
+
+    {
+      auto reader = pool.get_reader();
+      assert(journal_mode_is_wal(reader) == 1);
+
+      auto result = reader(
+          select(count(tab.id).as(sqlpp::alias::a)).from(tab).where(true));
+      assert(result.front().a == 101);
+      assert(reader(select(tab.id).from(tab).where(tab.intN == 1000)).empty());
+
+      // Readers cannot write.
+      try {
+        reader(insert_into(tab).default_values());
+        assert(false);
+      } catch (const sql::exception&) {
+      }
+    }
+    assert(pool.available_readers() == 3);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    remove_database(path);
+    return 1;
+  }
+  remove_database(path);
+  return 0;
+}